@@ -1,65 +1,214 @@
 #ifndef AI_HPP
 #define AI_HPP
 
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <vector>
-#include <unordered_map>
 #include "board.hpp"
+#include "evalcache.hpp"
+#include "experience.hpp"
 #include "pattern.hpp"
+#include "mcts.hpp"
+#include "nnue.hpp"
+#include "movelist.hpp"
+#include "movepicker.hpp"
+#include "searchlimits.hpp"
+#include "transposition.hpp"
 
+// Node-local scratch for one ply, preallocated in AI<N>::searchStack
+struct SearchStackEntry {
+    MoveList moves;
+    std::array<Move, 2> killers; // Quiet moves that caused a cutoff
+};
+
+// Pruning statistics, gathered by gomoku-bench --stats (pruning is then off)
+// to calibrate the width constants of AI<N>
+struct PruningStats {
+    static const int MAX_INDEX = 64;
+
+    // [depth][quiet moves searched when the cutoff came]
+    std::array<std::array<int64_t, MAX_INDEX>, SearchLimits::MAX_DEPTH + 1> cutoffs{};
+
+    // Exact deep score minus the reduced-depth score, per depth
+    std::array<int64_t, SearchLimits::MAX_DEPTH + 1> probCutSamples{};
+    std::array<double, SearchLimits::MAX_DEPTH + 1> probCutSum{};
+    std::array<double, SearchLimits::MAX_DEPTH + 1> probCutSquares{};
+};
+
+// Search engine used by findBestMove
+enum class SearchMode {
+    ALPHA_BETA,
+    MCTS
+};
+
+// Static evaluation at the alpha-beta leaves
+enum class Evaluation {
+    PATTERNS,
+    NNUE // Falls back to PATTERNS for sizes without an embedded network
+};
+
+// Node kinds of the alpha-beta tree (template parameter of AI<N>::search):
+// the root, nodes on the principal variation, searched with the full window,
+// and the rest, searched with a null window. Only non-PV nodes are pruned
+// by ProbCut.
+enum class NodeType {
+    ROOT,
+    PV,
+    NON_PV
+};
+
+// Best move of one completed iterative-deepening iteration
+struct IterationResult {
+    int depth;
+    Move move;
+    int score; // From the mover's side
+};
+
+// Largest tables of one engine (TT, evaluation cache, MCTS node pool) plus
+// the experience store: the rest of the 70 MB limit is left to the code,
+// the stacks and the small per-game tables
+inline constexpr int TABLE_MEMORY_BUDGET_MB = 64;
+static_assert(TranspositionTable::DEFAULT_SIZE_MB + EvalCache::MAX_SIZE_MB + MCTS<MAX_BOARD_SIZE>::POOL_SIZE_MB +
+              ExperienceStore::MEMORY_MB <= TABLE_MEMORY_BUDGET_MB, "tables over the memory budget");
+
+// Search engine for a Board<N> (instantiated for every supported size)
+template <int N>
 class AI {
     private:
         // AI configuration
-        static const int MAX_DEPTH = 6; // Search depth limit
-        static const int MAX_TIME_MS = 4900; // Stay under 5 seconds
+        // Adaptive width: quiet moves searched per node by remaining depth
+        // (late-move pruning), root moves, and a ProbCut reduced search at
+        // PROBCUT_MARGIN above beta. Forcing moves are never pruned.
+        // gomoku-bench --stats --depth 8 on 80 self-play positions: 99% of
+        // the cutoffs come within 1 quiet move at depths 1-6 and 3 at depth
+        // 7. LMP_MOVES is hand-set well above that, for the orderings the
+        // sample misses. The reduced search is off by 2 sd - mean = 17171
+        // over its 157 samples (depths 5-7), hence PROBCUT_MARGIN.
+        static constexpr int LMP_MOVES[] = {0, 4, 6, 8, 10, 12, 14};
+        static const int ROOT_MOVES = 24;
+        static const int PROBCUT_DEPTH = 5;
+        static const int PROBCUT_REDUCTION = 2;
+        static const int PROBCUT_MARGIN = 17000;
+        static const int EXPERIENCE_MIN_DEPTH = 4; // Shallower results are cheaper to redo than to keep
+        static const int INF_SCORE = 1000000000; // Safe to negate
+        static const int HISTORY_MAX = 4000; // History scores are halved past this
+        static const int MAX_PLY = SearchLimits::MAX_DEPTH + 1;
+        static const int CHECK_INTERVAL = 256; // Nodes between two limit checks
+        static const int SOFT_TIME_PERCENT = 50; // No new iteration past this share of the time
+        static const int CANONICAL_STONES = 10; // Up to this many stones, TT keys ignore symmetry
 
         // Search state
-        int nodesEvaluated;
+        int64_t nodesEvaluated;
         std::chrono::steady_clock::time_point startTime;
+        SearchLimits limits;
+        int64_t nextCheck; // Node count at which checkLimits runs again
+        bool softStop; // Soft deadline passed: finish the iteration, start no new one
+        std::atomic<bool> stopSearch; // Hard stop: unwind, the iteration is discarded
+
+        // Game-long search state: kept across TURNs, reset by newGame()
+        TranspositionTable transpositionTable;
+        EvalCache evalCache; // Leaf evaluations, cleared with the TT
+        std::array<std::array<int, N * N>, 2> history; // Cutoff counts per color / cell
+        std::array<SearchStackEntry, MAX_PLY> searchStack; // Ply 0 = root, no allocation while searching
+        std::vector<Move> principalVariation; // From the last completed iteration
+        uint64_t expectedHash; // Position after PV[0], PV[1]
+        Move rootMove; // Best move of the last root search
+        std::vector<Move> rootFilter; // Root moves this engine searches (cluster worker), empty = all
+        int lastScore; // Last findBestMove, from the mover's side
+        int lastDepth; // Last completed depth (PV length for MCTS)
+        std::vector<IterationResult> iterations; // Completed alpha-beta iterations, shallowest first
+        Cell rootColor; // Color of the game's alpha-beta searches, EMPTY before the first
+        bool mixedRootColors; // Searched for both colors: the TT scores cannot be saved
+        const ExperienceStore* experience; // Preloaded for rootColor at the first search
 
-        // Transposition table for memoization (optional future optimization)
-        std::unordered_map<uint64_t, int> transpositionTable;
+        // Engine selection
+        SearchMode searchMode;
+        Evaluation evaluation;
+        MCTS<N> mcts;
+        PruningStats* pruningStats; // Calibration mode when set
 
     public:
+        static const int WIN_SCORE = 100000; // Five on the board, from the side to move
+
         // Constructor
         AI();
 
         // Main AI interface
-        Move findBestMove(const Board& board, Cell myColor);
+        Move findBestMove(const Board<N>& board, Cell myColor);
 
         // Evaluation function
-        int evaluatePosition(const Board& board, Cell maximizingPlayer);
-        int evaluatePositionAdvanced(const Board& board, Cell maximizingPlayer);
+        int evaluatePosition(const Board<N>& board, Cell maximizingPlayer);
+        int evaluatePositionAdvanced(const Board<N>& board, Cell maximizingPlayer);
+        template <Cell ROOT_COLOR, Cell US>
+        int evaluateLeaf(const Board<N>& board);
 
-        // Minimax + Alpha-Beta
-        int alphaBeta(Board& board, int depth, int alpha, int beta,
-                      Cell maximizingPlayer, Cell currentPlayer);
+        // Alpha-beta (negamax, principal variation search), specialized per
+        // node type, root color (the side the evaluation is written for) and
+        // side to move
+        template <NodeType NODE_TYPE, Cell ROOT_COLOR, Cell US>
+        int search(Board<N>& board, int depth, int alpha, int beta, int ply);
+        template <Cell US>
+        bool isQuietNode(const Board<N>& board, const MoveList& moves) const;
 
         // Iterative deepening
-        Move iterativeDeepening(const Board& board, Cell myColor);
+        Move iterativeDeepening(const Board<N>& board, Cell myColor);
+        void setRootColor(Cell myColor);
+        void seedRootMoves(const Board<N>& board, MoveList& moves, bool closed);
+        void updatePrincipalVariation(const Board<N>& board, Cell myColor, int depth);
 
         // Move ordering and heuristics
-        std::vector<Move> getOrderedMoves(const Board& board, Cell myColor);
-        std::vector<Move> getOrderedMovesAdvanced(const Board& board, Cell myColor);
-        int getMoveScore(const Board& board, Move move, Cell myColor);
+        void getOrderedMoves(const Board<N>& board, Cell myColor, MoveList& moves);
+        bool getOrderedMovesAdvanced(const Board<N>& board, Cell myColor, MoveList& moves); // True when closed (forced or reduced)
+        bool reduceSymmetricMoves(const Board<N>& board, MoveList& moves);
+        int getMoveScore(const Board<N>& board, Move move, Cell myColor);
 
         // Smart move reduction (only consider relevant moves)
-        std::vector<Move> getRelevantMoves(const Board& board);
+        void getRelevantMoves(const Board<N>& board, MoveList& moves);
 
         // Pattern recognition
-        bool isWinningMove(const Board& board, Move move, Cell myColor);
-        bool isThreatBlocking(const Board& board, Move move, Cell opponentColor);
-        Move findImmediateWin(const Board& board, Cell myColor);
-        Move findImmediateThreat(const Board& board, Cell myColor);
+        bool isWinningMove(const Board<N>& board, Move move, Cell myColor);
+        bool isThreatBlocking(const Board<N>& board, Move move, Cell opponentColor);
+        Move findImmediateWin(const Board<N>& board, Cell myColor);
+        Move findImmediateThreat(const Board<N>& board, Cell myColor);
+        void setForcedResult(const Board<N>& board, Move move, Cell myColor);
+
+        // Root splitting (cluster): the root moves findBestMove would search,
+        // false when it plays without searching; then search only a subset
+        bool getRootMoves(const Board<N>& board, Cell myColor, MoveList& moves);
+        void setRootMoves(const std::vector<Move>& moves) { rootFilter = moves; }
+
+        // Engine selection
+        void setSearchMode(SearchMode mode) { searchMode = mode; }
+        SearchMode getSearchMode() const { return searchMode; }
+        void setEvaluation(Evaluation mode) { evaluation = mode; evalCache.clear(); }
+        Evaluation getEvaluation() const { return evaluation; }
+        void setThreads(int threads) { mcts.setThreads(threads); }
+        void setLimits(const SearchLimits& searchLimits) { limits = searchLimits; }
+        void setPruningStats(PruningStats* stats) { pruningStats = stats; }
+        void setEvalCacheSize(int megabytes) { evalCache.resize(megabytes); }
+        const SearchLimits& getLimits() const { return limits; }
+
+        // Results of earlier games: attach after newGame (the entries of the
+        // color searched are preloaded at the first search), collect before
+        // the next one
+        void loadExperience(const ExperienceStore& store);
+        void saveExperience(ExperienceStore& store) const;
 
         // Utility functions
+        void newGame();
         void resetSearchStats();
-        int getNodesEvaluated() const { return nodesEvaluated; }
-        bool isTimeUp() const;
-        uint64_t hashBoard(const Board& board) const;
-
-        // Helper
-        Cell getOpponentColor(Cell player) const;
+        const std::vector<Move>& getPrincipalVariation() const { return principalVariation; }
+        int getLastScore() const { return lastScore; }
+        int getLastDepth() const { return lastDepth; }
+        const std::vector<IterationResult>& getIterations() const { return iterations; }
+        int64_t getNodesEvaluated() const { return nodesEvaluated; }
+        const EvalCache& getEvalCache() const { return evalCache; } // Hits / misses of the last search
+        int64_t getPlayouts() const { return mcts.getPlayouts(); }
+        void checkLimits();
+        bool isStopped() const { return stopSearch.load(std::memory_order_relaxed); }
+        void requestStop() { stopSearch.store(true, std::memory_order_relaxed); }
+        uint64_t hashBoard(const Board<N>& board, int& symmetry) const; // TT key, move symmetry
 };
 
 #endif // AI_HPP
@@ -0,0 +1,53 @@
+#ifndef ANALYSIS_HPP
+#define ANALYSIS_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include "engine.hpp"
+
+// Batch position analysis (--analyze FILE). One position per line:
+//   [size] x,y x,y ...   (moves alternate starting with BLACK, size 20 by default)
+// Empty lines and lines starting with '#' are skipped. Positions are read as
+// a stream and searched by a pool of workers, each with its own Engine;
+// results are written in input order as soon as they are known:
+//   position <line>: move x,y score S depth D nodes N pv x,y x,y ...
+class BatchAnalyzer {
+    private:
+        struct Task {
+            long sequence;
+            int line;
+            std::string text;
+        };
+
+        EngineOptions options;
+        int jobs;
+
+        // Reader -> workers
+        std::mutex queueMutex;
+        std::condition_variable queueChanged;
+        std::deque<Task> queue;
+        bool inputDone;
+
+        // Workers -> output, reordered by sequence number
+        std::mutex outputMutex;
+        std::map<long, std::string> pending;
+        long nextToWrite;
+        std::ostream* output;
+
+        void worker();
+        std::string analyze(const Task& task, std::unique_ptr<Engine>& engine);
+        void publish(long sequence, std::string text);
+
+    public:
+        // Constructor (jobs <= 0 uses every hardware thread)
+        BatchAnalyzer(const EngineOptions& options, int jobs);
+
+        // Analyze every position of input, returns when all results are written
+        void run(std::istream& input, std::ostream& out);
+};
+
+#endif // ANALYSIS_HPP
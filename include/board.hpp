@@ -1,7 +1,10 @@
 #ifndef BOARD_HPP
 #define BOARD_HPP
 
+#include <algorithm>
 #include <array>
+#include <cstdint>
+#include <span>
 #include <vector>
 #include <utility>
 
@@ -11,19 +14,177 @@ enum class Cell : char {
     WHITE = 'O'
 };
 
+// Other color (constexpr: usable on template arguments)
+constexpr Cell opponentOf(Cell player) {
+    return (player == Cell::BLACK) ? Cell::WHITE : Cell::BLACK;
+}
+
 using Position = std::pair<int, int>;
 using Move = std::pair<int, int>;
 
+// Line geometry: every row, column, diagonal and anti-diagonal is one 32-bit
+// lane, bit i = cell with x == i (y == i for columns). Cells outside a line
+// never have their bit set, so they read as blocked.
+template <int N>
+struct LineGeometry {
+    static_assert(N >= 5 && N <= 32, "lines must fit in 32-bit lanes");
+
+    static constexpr int LINE_COUNT = 6 * N - 2;
+    static constexpr int LANES = (LINE_COUNT + 7) & ~7; // Padded for 8-lane vectors
+
+    static constexpr int row(int, int y) { return y; }
+    static constexpr int column(int x, int) { return N + x; }
+    static constexpr int diagonal(int x, int y) { return 2 * N + (x - y + N - 1); }
+    static constexpr int antiDiagonal(int x, int y) { return 4 * N - 1 + (x + y); }
+
+    // Bits that belong to the board in each lane
+    static constexpr std::array<uint32_t, LANES> validMasks = [] {
+        std::array<uint32_t, LANES> masks{};
+        for (int y = 0; y < N; y++) {
+            for (int x = 0; x < N; x++) {
+                masks[row(x, y)] |= 1u << x;
+                masks[column(x, y)] |= 1u << y;
+                masks[diagonal(x, y)] |= 1u << x;
+                masks[antiDiagonal(x, y)] |= 1u << x;
+            }
+        }
+        return masks;
+    }();
+};
+
+// Zobrist keys per color and cell. Fixed seed: hashes are stable across runs.
+template <int N>
+struct ZobristKeys {
+    static constexpr std::array<std::array<uint64_t, N * N>, 2> keys = [] {
+        std::array<std::array<uint64_t, N * N>, 2> table{};
+        uint64_t state = 0x9E3779B97F4A7C15ULL;
+        for (auto& color : table) {
+            for (auto& key : color) {
+                // splitmix64
+                state += 0x9E3779B97F4A7C15ULL;
+                uint64_t z = state;
+                z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+                key = z ^ (z >> 31);
+            }
+        }
+        return table;
+    }();
+};
+
+// The 8 symmetries of the square board: bit 2 = transpose first, then bit 0 =
+// mirror x, bit 1 = mirror y. Symmetry 0 is the identity.
+template <int N>
+struct BoardSymmetry {
+    static constexpr int COUNT = 8;
+
+    static constexpr Move apply(Move move, int symmetry) {
+        int x = (symmetry & 4) ? move.second : move.first;
+        int y = (symmetry & 4) ? move.first : move.second;
+        return Move((symmetry & 1) ? N - 1 - x : x, (symmetry & 2) ? N - 1 - y : y);
+    }
+    static constexpr Move invert(Move move, int symmetry) {
+        int x = (symmetry & 1) ? N - 1 - move.first : move.first;
+        int y = (symmetry & 2) ? N - 1 - move.second : move.second;
+        return (symmetry & 4) ? Move(y, x) : Move(x, y);
+    }
+
+    // Image of each cell index under each symmetry
+    static constexpr std::array<std::array<uint16_t, N * N>, COUNT> cells = [] {
+        std::array<std::array<uint16_t, N * N>, COUNT> table{};
+        for (int symmetry = 0; symmetry < COUNT; symmetry++) {
+            for (int cell = 0; cell < N * N; cell++) {
+                Move image = apply(Move(cell % N, cell / N), symmetry);
+                table[symmetry][cell] = static_cast<uint16_t>(image.second * N + image.first);
+            }
+        }
+        return table;
+    }();
+};
+
+// Board sizes with an explicit instantiation of the engine (START n)
+inline constexpr int SUPPORTED_BOARD_SIZES[] = {15, 20};
+inline constexpr int MAX_BOARD_SIZE = 20;
+
+// First layer of the evaluation network (nnue.hpp), one row per perspective
+// (index 0 = BLACK, 1 = WHITE). Kept up to date by placeStone/removeStone.
+inline constexpr int NNUE_ACCUMULATOR_SIZE = 32;
+
+struct NnueAccumulator {
+    alignas(32) std::array<std::array<int16_t, NNUE_ACCUMULATOR_SIZE>, 2> values;
+};
+
+// Threat map classes: what a stone of one color on a cell would make along
+// a line (computed as if the cell held that stone, whatever it holds now).
+// Exact in freestyle rules: "completions" are the empty cells of the line
+// that would then give five through the new stone. Each direction holds at
+// most one class, the strongest.
+enum ThreatFlag : uint8_t {
+    THREAT_FIVE = 1,          // Five or more
+    THREAT_STRAIGHT_FOUR = 2, // Two completions (.XXXX.)
+    THREAT_FOUR = 4,          // One completion, gaps included (XXXX., XX.XX, X.XXX)
+    THREAT_OPEN_THREE = 8,    // One more stone can make a straight four (.XXX., .X.XX.)
+    THREAT_THREE = 16,        // One more stone can only make a four
+    THREAT_ANY_FOUR = THREAT_FIVE | THREAT_STRAIGHT_FOUR | THREAT_FOUR,
+    THREAT_ANY = THREAT_ANY_FOUR | THREAT_OPEN_THREE | THREAT_THREE
+};
+
+// Rectangle of cells, bounds included (empty when minX > maxX)
+struct BoardArea {
+    int minX;
+    int minY;
+    int maxX;
+    int maxY;
+
+    bool isEmpty() const { return minX > maxX; }
+};
+
+// Line directions of the threat map, in this order: row, column, diagonal, anti-diagonal
+inline constexpr int LINE_DIRECTIONS[4][2] = {{1, 0}, {0, 1}, {1, 1}, {1, -1}};
+
+// Board of N x N cells. All geometry is compile-time; Board<15> and
+// Board<20> are instantiated in board.cpp.
+template <int N>
 class Board {
-    private:
+    public:
         // Board state constants
-        static const int BOARD_SIZE = 20;
+        static constexpr int BOARD_SIZE = N;
+        static constexpr int CELL_COUNT = N * N;
+        static constexpr int CENTER = N / 2;
+
+        using Lines = LineGeometry<N>;
+        using Zobrist = ZobristKeys<N>;
+        using Symmetry = BoardSymmetry<N>;
 
+    private:
         // Board representation
-        std::array<std::array<Cell, BOARD_SIZE>, BOARD_SIZE> grid;
+        std::array<std::array<Cell, N>, N> grid;
+
+        // Same stones packed per line (index 0 = BLACK, 1 = WHITE)
+        alignas(32) std::array<std::array<uint32_t, Lines::LANES>, 2> lineMasks;
+
+        // Evaluation network first layer
+        NnueAccumulator accumulator;
+
+        // Threat map per color and cell: ThreatFlag of each direction, one
+        // byte per direction. Only the lines through a changed cell are
+        // refreshed.
+        std::array<std::array<uint32_t, CELL_COUNT>, 2> lineThreats;
+
+        // Stones per color as cell indexes (y * N + x, unordered), and the
+        // slot of each stone in its list: removal swaps in the last one
+        std::array<std::array<uint16_t, CELL_COUNT>, 2> stones;
+        std::array<int, 2> stoneCounts;
+        std::array<uint16_t, CELL_COUNT> stoneSlots;
+
+        // Bounding box of all stones: grown by each placement, recomputed
+        // from the lists when a stone on its edge goes
+        BoardArea stoneBox;
 
         // Game state
         int moveCount;
+        uint64_t hash; // Zobrist hash, updated incrementally
+        std::array<uint64_t, BoardSymmetry<N>::COUNT> symmetricHashes; // Hash of each symmetric image
 
     public:
         // Constructor
@@ -45,9 +206,58 @@ class Board {
         void printBoard() const;
         int getBoardSize() const { return BOARD_SIZE; }
         int getMoveCount() const { return moveCount; }
+        uint64_t getHash() const { return hash; }
+
+        // Symmetry: smallest hash among the 8 images of the position (and
+        // the symmetry giving it), and the symmetries that leave the
+        // position unchanged (bit s set, bit 0 always)
+        uint64_t getCanonicalHash(int& symmetry) const;
+        uint8_t getSymmetries() const;
+
+        // Stones of one color as cell indexes (y * N + x), in no particular order
+        std::span<const uint16_t> getStones(Cell stone) const {
+            int color = (stone == Cell::BLACK) ? 0 : 1;
+            return std::span<const uint16_t>(stones[color].data(), stoneCounts[color]);
+        }
+
+        // Bounding box of the stones grown by margin and clipped to the
+        // board (empty without stones): where whole-board scans can stop
+        BoardArea getStoneArea(int margin) const {
+            if (stoneBox.isEmpty()) {
+                return stoneBox;
+            }
+            return BoardArea{std::max(stoneBox.minX - margin, 0), std::max(stoneBox.minY - margin, 0),
+                             std::min(stoneBox.maxX + margin, N - 1), std::min(stoneBox.maxY + margin, N - 1)};
+        }
+
+        // Packed line masks for whole-board evaluation kernels
+        const uint32_t* getLineMasks(Cell stone) const { return lineMasks[stone == Cell::BLACK ? 0 : 1].data(); }
+
+        // Network accumulator for Nnue<N>::evaluate
+        const NnueAccumulator& getAccumulator() const { return accumulator; }
+
+        // Threat map reads: class of one direction, or the classes of all four together
+        uint8_t getLineThreats(int x, int y, int direction, Cell stone) const {
+            return static_cast<uint8_t>(lineThreats[stone == Cell::BLACK ? 0 : 1][y * N + x] >> (8 * direction));
+        }
+        uint8_t getThreats(int x, int y, Cell stone) const {
+            uint32_t lines = lineThreats[stone == Cell::BLACK ? 0 : 1][y * N + x];
+            lines |= lines >> 16;
+            return static_cast<uint8_t>(lines | (lines >> 8));
+        }
+
+        // Class of (x, y) along one direction if the cell (bx, by) on that
+        // line were taken by the other color (exact defense probing)
+        uint8_t probeLineThreats(int x, int y, int direction, Cell stone, int bx, int by) const;
 
         // Helper for detection algorithms
         int countConsecutive(int x, int y, int dx, int dy, Cell stone) const;
+
+    private:
+        void indexStone(int x, int y, Cell stone);
+        void unindexStone(int x, int y);
+        void recomputeStoneBox();
+        void updateThreats(int x, int y);
 };
 
 #endif // BOARD_HPP
@@ -0,0 +1,91 @@
+#ifndef CLUSTER_HPP
+#define CLUSTER_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "engine.hpp"
+
+// Root splitting across engine processes, on one machine or several.
+// A worker (pbrain-gomoku-ai --serve ADDRESS) listens on a TCP "host:port"
+// or a Unix socket path and searches what it is sent. A ClusterEngine
+// (--cluster ADDRESS,...) keeps the position locally, deals the root moves
+// out to its workers round robin (in move-ordering order, so the likely best
+// moves land on different workers), waits for the answers until a deadline
+// shared by all of them, and plays the best one at the deepest depth all of
+// them completed (scores of different depths do not compare). Connections
+// stay open from one move to the next, so each worker keeps its tables for
+// the whole game.
+//
+// Text protocol, one message per line:
+//   NEWGAME                                       clear the worker's tables
+//   SEARCH <id> <size> <X|O> <depth> <nodes> <timeMs> <x,y,X|O>... ; <x,y>...
+//   RESULT <id> <x,y> <score> <depth> <nodes> <depth:x,y:score>...
+//   ERROR <id> <reason>
+// SEARCH carries the stones before ';' and the worker's root moves after it,
+// the color to move and the limits (0 = none; the time is what is left of the
+// turn). RESULT ends with the best move and score of every completed
+// iteration, shallowest first. An answer with an older id (a worker that
+// missed a deadline) is dropped.
+
+// Engine that delegates everything to a local engine except the search
+class ClusterEngine : public Engine {
+    private:
+        static const int NETWORK_MARGIN_MS = 100; // Worker budget: the turn minus this
+        static const int COLLECT_MARGIN_MS = 50;  // Answers are awaited until the turn minus this
+
+        struct Worker {
+            std::string address;
+            int socket = -1;
+            std::string input; // Received, not yet split into lines
+        };
+
+        std::unique_ptr<Engine> local;
+        std::vector<Worker> workers;
+        SearchLimits limits;
+        SearchInfo lastInfo; // Of the last split search
+        bool distributed;    // Last search was split (else the local engine has the info)
+        long requestId;
+
+        void connectWorkers();
+        void disconnect(Worker& worker);
+        bool sendRequest(Worker& worker, const std::string& line);
+        std::string describeStones() const;
+        Move searchLocally(Cell myColor, int elapsedMs);
+
+    public:
+        ClusterEngine(std::unique_ptr<Engine> local, const std::vector<std::string>& addresses);
+        ~ClusterEngine() override;
+
+        int getConnectedWorkers() const;
+
+        // Game state: the local engine's
+        int getBoardSize() const override { return local->getBoardSize(); }
+        void newGame() override;
+        void clearBoard() override { local->clearBoard(); }
+        bool isValidMove(int x, int y) const override { return local->isValidMove(x, y); }
+        void placeStone(int x, int y, Cell stone) override { local->placeStone(x, y, stone); }
+        int getMoveCount() const override { return local->getMoveCount(); }
+        bool checkWin(int x, int y, Cell stone) const override { return local->checkWin(x, y, stone); }
+        std::vector<Move> getStones(Cell stone) const override { return local->getStones(stone); }
+
+        // Split search, locally when there is nothing to split or no worker answers
+        void setLimits(const SearchLimits& searchLimits) override;
+        Move findBestMove(Cell myColor) override;
+        Move getFallbackMove() const override { return local->getFallbackMove(); }
+        void getSearchInfo(SearchInfo& info) const override;
+        std::vector<Move> getRootMoves(Cell myColor) override { return local->getRootMoves(myColor); }
+        void setRootMoves(const std::vector<Move>& moves) override { local->setRootMoves(moves); }
+
+        void loadExperience(const ExperienceStore& store) override { local->loadExperience(store); }
+        void saveExperience(ExperienceStore& store) const override { local->saveExperience(store); }
+};
+
+// Worker side (--serve): answers one coordinator at a time, until killed
+class ClusterWorker {
+    public:
+        // Returns false (with the reason on stderr) when the address cannot be used
+        static bool serve(const std::string& address, const EngineOptions& options);
+};
+
+#endif // CLUSTER_HPP
@@ -0,0 +1,66 @@
+#ifndef ENGINE_HPP
+#define ENGINE_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "board.hpp"
+#include "ai.hpp"
+
+// Startup options applied to every engine created by the protocol
+struct EngineOptions {
+    SearchMode searchMode = SearchMode::ALPHA_BETA;
+    Evaluation evaluation = Evaluation::PATTERNS;
+    int threads = 1;
+    int evalCacheMb = EvalCache::DEFAULT_SIZE_MB; // 0 = off
+    std::vector<std::string> clusterWorkers; // Worker addresses: searches are split across them
+    SearchLimits limits;
+};
+
+// What the last findBestMove found (score from the mover's side)
+struct SearchInfo {
+    int score = 0;
+    int depth = 0;
+    int64_t nodes = 0; // Alpha-beta nodes or MCTS playouts
+    std::vector<Move> principalVariation;
+    std::vector<IterationResult> iterations; // Alpha-beta only, shallowest first
+};
+
+// Size-independent handle on a Board<N> + AI<N> pair. START n picks the
+// instantiation once; everything after that goes through this interface.
+class Engine {
+    public:
+        virtual ~Engine() = default;
+
+        // Factory, nullptr when n is not in SUPPORTED_BOARD_SIZES
+        static std::unique_ptr<Engine> create(int boardSize, const EngineOptions& options);
+
+        // Game state
+        virtual int getBoardSize() const = 0;
+        virtual void newGame() = 0;
+        virtual void clearBoard() = 0;
+        virtual bool isValidMove(int x, int y) const = 0;
+        virtual void placeStone(int x, int y, Cell stone) = 0;
+        virtual int getMoveCount() const = 0;
+        virtual bool checkWin(int x, int y, Cell stone) const = 0;
+
+        // Search (may return an invalid move, see getFallbackMove)
+        virtual void setLimits(const SearchLimits& limits) = 0;
+        virtual Move findBestMove(Cell myColor) = 0;
+        virtual Move getFallbackMove() const = 0;
+        virtual void getSearchInfo(SearchInfo& info) const = 0;
+
+        // Experience file: attach after newGame (preloaded at the first search,
+        // for the color searched), save when the game is over
+        virtual void loadExperience(const ExperienceStore& store) = 0;
+        virtual void saveExperience(ExperienceStore& store) const = 0;
+
+        // Root splitting (ClusterEngine): the stones, the root moves to share
+        // out (empty when no search is needed), and a subset to search
+        virtual std::vector<Move> getStones(Cell stone) const = 0;
+        virtual std::vector<Move> getRootMoves(Cell myColor) = 0;
+        virtual void setRootMoves(const std::vector<Move>& moves) = 0;
+};
+
+#endif // ENGINE_HPP
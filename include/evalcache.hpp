@@ -0,0 +1,72 @@
+#ifndef EVALCACHE_HPP
+#define EVALCACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Direct-mapped cache of static evaluations, separate from the transposition
+// table: leaves are never stored in the TT, and positions reached again
+// through transpositions (or in the next turn's search) skip the whole-board
+// evaluation. Keys are the board's Zobrist hash mixed with the side to move
+// and the root color (the evaluation is not symmetric); see key().
+// An entry is 8 bytes: the high half of the key, as a check, and the score.
+class EvalCache {
+    public:
+        static const int DEFAULT_SIZE_MB = 4;
+        static const int MAX_SIZE_MB = 8; // Within the engine's memory budget (ai.hpp)
+
+    private:
+        struct Entry {
+            uint32_t check; // Key >> 32, low bit set: 0 is an empty slot
+            int32_t score;
+        };
+
+        std::vector<Entry> entries;
+        uint64_t mask;
+        int64_t hits;
+        int64_t misses;
+
+        static uint32_t getCheck(uint64_t key) { return static_cast<uint32_t>(key >> 32) | 1; }
+
+    public:
+        EvalCache();
+
+        // Megabytes, clamped to [0, MAX_SIZE_MB] and rounded down to a power
+        // of two entries; 0 turns the cache off
+        void resize(int megabytes);
+        void clear();
+        size_t getSize() const { return entries.size(); }
+
+        bool probe(uint64_t key, int& score) {
+            if (entries.empty()) {
+                return false;
+            }
+            const Entry& slot = entries[key & mask];
+            if (slot.check != getCheck(key)) {
+                misses++;
+                return false;
+            }
+            hits++;
+            score = slot.score;
+            return true;
+        }
+
+        void store(uint64_t key, int score) {
+            if (!entries.empty()) {
+                entries[key & mask] = Entry{getCheck(key), score};
+            }
+        }
+
+        // Position hash plus who moves and whose evaluation it is
+        static constexpr uint64_t key(uint64_t hash, bool blackToMove, bool blackRoot) {
+            return hash ^ (blackToMove ? 0x9e3779b97f4a7c15ULL : 0) ^ (blackRoot ? 0xc2b2ae3d27d4eb4fULL : 0);
+        }
+
+        // Counters since the last resetStats
+        int64_t getHits() const { return hits; }
+        int64_t getMisses() const { return misses; }
+        void resetStats() { hits = 0; misses = 0; }
+};
+
+#endif // EVALCACHE_HPP
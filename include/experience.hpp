@@ -0,0 +1,97 @@
+#ifndef EXPERIENCE_HPP
+#define EXPERIENCE_HPP
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "board.hpp"
+#include "transposition.hpp"
+
+// Deep search results kept across processes. The file is a 16-byte header
+// ("GMKX", version, entry size, session counter, entry count) followed by
+// fixed-size entries in host byte order:
+//
+//   offset 0   uint64  transposition key (Board<N> Zobrist / canonical hash)
+//          8   int32   score
+//         12   int16   move, packed (y << 5) | x
+//         14   int8    depth
+//         15   uint8   bound
+//         16   uint8   board size (keys of different sizes never mix)
+//         17   uint8   root color, 1 = black, 2 = white (the evaluation,
+//                      so every score, is written for the searching side)
+//         18   uint8   reserved x 2
+//         20   uint32  session in which the entry was last searched (LRU)
+//
+// The file is read once at startup; new results are merged in
+// memory and the whole file is rewritten (temporary file + rename) by
+// flush(), keeping the most recently searched entries when full.
+struct ExperienceEntry {
+    uint64_t key;
+    int32_t score;
+    int16_t move;
+    int8_t depth;
+    uint8_t bound;
+    uint8_t boardSize;
+    uint8_t rootColor;
+    uint8_t reserved[2];
+    uint32_t lastUsed;
+};
+
+static_assert(sizeof(ExperienceEntry) == 24, "experience entries are written as is");
+
+class ExperienceStore {
+    public:
+        // Entries kept by flush. record evicts down to it once the store
+        // grows a quarter past it, so at most 7.5 MB of entries plus a 2 MB
+        // index are in memory (MEMORY_MB).
+        static const size_t DEFAULT_MAX_ENTRIES = 1 << 18;
+        static const int MEMORY_MB = 10;
+
+    private:
+        static const uint8_t ROOT_BLACK = 1;
+        static const uint8_t ROOT_WHITE = 2;
+
+        std::string path;
+        size_t maxEntries;
+        uint32_t session; // One per process run, stamps the entries it writes
+        std::vector<ExperienceEntry> entries;
+        std::vector<uint32_t> index; // Open addressing on the key: entry + 1, 0 = free
+        bool dirty;
+
+        // Entries in memory at most, and index slots for them (load <= 3/4)
+        static constexpr size_t getEntryLimit(size_t maxEntries) { return maxEntries + maxEntries / 4; }
+        static constexpr size_t getIndexSize(size_t maxEntries) {
+            return std::bit_ceil(getEntryLimit(maxEntries) * 4 / 3 + 1);
+        }
+
+        // Slot of the entry with this key and root color, or the free slot
+        // where it goes: the same position searched for the other color is
+        // another entry
+        size_t findSlot(uint64_t key, uint8_t rootColor) const;
+        void rebuildIndex();
+        void evict(); // Down to maxEntries, least recently searched first
+
+    public:
+        ExperienceStore();
+
+        // Load path if it exists (a missing file is an empty store), false
+        // when it cannot be read or is not an experience file
+        bool open(const std::string& path, size_t maxEntries = DEFAULT_MAX_ENTRIES);
+        bool isOpen() const { return !path.empty(); }
+
+        // Entries of one board size searched for one root color, in TT form
+        void getEntries(int boardSize, Cell rootColor, std::vector<TTEntry>& out) const;
+
+        // Merge a result searched this session (the deeper one wins)
+        void record(int boardSize, Cell rootColor, const TTEntry& entry);
+
+        // Evict the least recently searched entries past maxEntries and
+        // rewrite the file. Nothing is written when nothing changed.
+        bool flush();
+
+        size_t size() const { return entries.size(); }
+};
+
+#endif // EXPERIENCE_HPP
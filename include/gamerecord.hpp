@@ -0,0 +1,136 @@
+#ifndef GAMERECORD_HPP
+#define GAMERECORD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "board.hpp"
+
+// Binary game records. A file is an 8-byte header ("GMKR", version,
+// record header size) followed by records appended one after another:
+//
+//   offset 0   uint32  record size in bytes (header included)
+//          4   uint8   board size
+//          5   uint8   result (GameResult)
+//          6   uint8   color played by the engine (0 = both / unknown)
+//          7   uint8   reserved
+//          8   uint16  move count n
+//         10   uint16  reserved
+//         12   uint32  start time (unix seconds)
+//         16   moves   9 bits each (y * size + x), LSB first, padded to a byte
+//              depth   n x uint8  (0 = not searched, e.g. opponent moves)
+//              score   n x int32  (from the mover's side)
+//              time    n x uint16 (milliseconds, saturated)
+//
+// All integers are little-endian. A truncated last record (crash while
+// writing) is ignored by the reader.
+
+enum class GameResult : uint8_t {
+    UNKNOWN = 0,
+    BLACK_WIN = 1,
+    WHITE_WIN = 2,
+    DRAW = 3
+};
+
+// One move with what the search reported for it
+struct RecordedMove {
+    Move move;
+    int depth;
+    int score;
+    int timeMs;
+};
+
+// Game being recorded, in memory until it is appended
+struct GameRecord {
+    int boardSize = 20;
+    GameResult result = GameResult::UNKNOWN;
+    Cell engineColor = Cell::EMPTY;
+    uint32_t startTime = 0;
+    std::vector<RecordedMove> moves;
+
+    void clear();
+};
+
+// Append-only writer with a large stdio buffer: one fwrite per game
+class GameRecordWriter {
+    private:
+        static const size_t BUFFER_SIZE = 1 << 20;
+
+        std::FILE* file;
+        std::vector<char> buffer;   // stdio buffer
+        std::vector<uint8_t> bytes; // Serialized record, reused
+
+    public:
+        GameRecordWriter();
+        ~GameRecordWriter();
+        GameRecordWriter(const GameRecordWriter&) = delete;
+        GameRecordWriter& operator=(const GameRecordWriter&) = delete;
+
+        // Open (or create) a record file for appending
+        bool open(const std::string& path);
+        bool isOpen() const { return file != nullptr; }
+        void close();
+
+        bool append(const GameRecord& game);
+        void flush();
+};
+
+// Read-only view on one record inside a mapped file
+class GameRecordView {
+    private:
+        const uint8_t* data;
+
+    public:
+        GameRecordView() : data(nullptr) {}
+        explicit GameRecordView(const uint8_t* recordData) : data(recordData) {}
+
+        uint32_t getRecordSize() const;
+        int getBoardSize() const { return data[4]; }
+        GameResult getResult() const { return static_cast<GameResult>(data[5]); }
+        Cell getEngineColor() const;
+        int getMoveCount() const;
+        uint32_t getStartTime() const;
+
+        Move getMove(int index) const;
+        int getDepth(int index) const;
+        int getScore(int index) const;
+        int getTimeMs(int index) const;
+};
+
+// Memory-mapped record file (read into memory where mmap is unavailable).
+// Records are variable-sized: iterate with next(), or index them once.
+class GameRecordReader {
+    private:
+        const uint8_t* data;
+        size_t size;
+        size_t offset;
+        std::vector<uint8_t> fallback;
+#ifndef _WIN32
+        void* mapping;
+#endif
+
+        bool isCompleteRecord(size_t position) const;
+
+    public:
+        GameRecordReader();
+        ~GameRecordReader();
+        GameRecordReader(const GameRecordReader&) = delete;
+        GameRecordReader& operator=(const GameRecordReader&) = delete;
+
+        bool open(const std::string& path);
+        void close();
+
+        // Sequential access from the first record
+        void rewind();
+        bool next(GameRecordView& record);
+
+        // Offsets of all complete records, for random access with recordAt
+        std::vector<size_t> buildIndex() const;
+        GameRecordView recordAt(size_t recordOffset) const { return GameRecordView(data + recordOffset); }
+
+        static uint32_t encodedSize(int moveCount);
+};
+
+#endif // GAMERECORD_HPP
@@ -0,0 +1,91 @@
+#ifndef GOMOKUENGINE_H
+#define GOMOKUENGINE_H
+
+/*
+ * C interface of the engine (libgomokuengine.a / libgomokuengine.so).
+ *
+ * One gomoku_engine holds a board of one supported size (15 or 20) and its
+ * search state (transposition table, history), which carries over from one
+ * search to the next until gomoku_engine_new_game. Calls on one handle are
+ * not thread-safe; separate handles are independent.
+ *
+ * Functions returning int return GOMOKU_OK (0) or a negative GOMOKU_ERROR_*.
+ * No C++ exception ever leaves the library: an allocation failure (or any
+ * other internal error) is GOMOKU_ERROR_INTERNAL, or a null handle from
+ * gomoku_engine_create. The handle stays usable afterwards.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(_WIN32)
+#define GOMOKU_API
+#else
+#define GOMOKU_API __attribute__((visibility("default")))
+#endif
+
+enum {
+    GOMOKU_OK = 0,
+    GOMOKU_ERROR_ARGUMENT = -1, /* Null handle / pointer, negative count */
+    GOMOKU_ERROR_MOVE = -2,     /* Move off the board or on a stone */
+    GOMOKU_ERROR_OPTION = -3,   /* Unknown option or value */
+    GOMOKU_ERROR_NO_MOVE = -4,  /* Board full */
+    GOMOKU_ERROR_INTERNAL = -5  /* Out of memory or other internal failure */
+};
+
+typedef struct gomoku_engine gomoku_engine;
+
+typedef struct {
+    int x;
+    int y;
+} gomoku_move;
+
+/* 0 means no limit; all zero is the default budget (depth 6, 4.9 s) */
+typedef struct {
+    int depth;
+    long long nodes;
+    int time_ms;
+} gomoku_limits;
+
+/* Null when board_size is not supported or the engine cannot be allocated */
+GOMOKU_API gomoku_engine* gomoku_engine_create(int board_size);
+GOMOKU_API void gomoku_engine_destroy(gomoku_engine* engine);
+
+/*
+ * Options, as strings:
+ *   "search"   "alphabeta" | "mcts"
+ *   "eval"     "patterns" | "nnue"
+ *   "threads"  MCTS worker count, >= 1
+ *   "eval_cache"  evaluation cache size in MB, 0 (off) to 8
+ * Changing one keeps the position but starts a new search state. On
+ * GOMOKU_ERROR_INTERNAL the previous options and engine are kept.
+ */
+GOMOKU_API int gomoku_engine_set_option(gomoku_engine* engine, const char* name, const char* value);
+
+/* Empty board and fresh search state */
+GOMOKU_API int gomoku_engine_new_game(gomoku_engine* engine);
+
+/*
+ * Replace the position by moves[0..count), played alternately starting with
+ * black. The side to move is black when count is even. On any error the
+ * board is left empty.
+ */
+GOMOKU_API int gomoku_engine_set_position(gomoku_engine* engine, const gomoku_move* moves, int count);
+
+/* Search the position for the side to move (limits may be null: defaults) */
+GOMOKU_API int gomoku_engine_search(gomoku_engine* engine, const gomoku_limits* limits, gomoku_move* best);
+
+/* Results of the last search: score from the mover's side, completed depth
+ * (PV length for MCTS), nodes (or playouts), and the principal variation
+ * (copied up to capacity, returns its full length) */
+GOMOKU_API int gomoku_engine_get_score(const gomoku_engine* engine);
+GOMOKU_API int gomoku_engine_get_depth(const gomoku_engine* engine);
+GOMOKU_API long long gomoku_engine_get_nodes(const gomoku_engine* engine);
+GOMOKU_API int gomoku_engine_get_pv(const gomoku_engine* engine, gomoku_move* pv, int capacity);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GOMOKUENGINE_H */
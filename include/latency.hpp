@@ -0,0 +1,40 @@
+#ifndef LATENCY_HPP
+#define LATENCY_HPP
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Wall time of every move of a game, from the command line being read to
+// the answer being flushed: search, unwinding, fallback and I/O included.
+// Summarized at END as percentiles, a histogram, and two counters: moves
+// over the search budget (eating into the safety margin) and moves past the
+// tournament deadline.
+class LatencyStats {
+    public:
+        static const int DEADLINE_MS = 5000; // Gomocup turn limit
+        static const int BUCKET_COUNT = 10;
+        static constexpr int BUCKET_LIMITS_MS[BUCKET_COUNT - 1] = {10, 100, 1000, 2000, 3000, 4000, 4500, 4900, 5000};
+
+    private:
+        std::vector<int64_t> samples; // Microseconds
+        std::array<int, BUCKET_COUNT> buckets;
+        int overBudget;
+        int missed;
+
+    public:
+        LatencyStats();
+
+        void clear();
+        void add(int64_t microseconds, int budgetMs);
+
+        int getMoveCount() const { return static_cast<int>(samples.size()); }
+
+        // "moves 57 p50 812.4ms p99 4903.0ms max 4921.7ms over-budget 3 missed 0"
+        std::string getSummary() const;
+        // "<10ms:5 <100ms:10 ... >=5000ms:0"
+        std::string getHistogram() const;
+};
+
+#endif // LATENCY_HPP
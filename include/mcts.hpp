@@ -0,0 +1,145 @@
+#ifndef MCTS_HPP
+#define MCTS_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "board.hpp"
+#include "pattern.hpp"
+#include "searchlimits.hpp"
+
+// Monte Carlo tree search (PUCT selection, pattern priors, static-eval leaves)
+template <int N>
+class MCTS {
+    public:
+        static const int POOL_SIZE_MB = 24; // Counted in the engine's memory budget (ai.hpp)
+
+    private:
+        // Search configuration
+        static const int MAX_CHILDREN = 24;        // Candidates kept per node
+        static const int NODE_POOL_SIZE = 1 << 20; // POOL_SIZE_MB of nodes (see Node)
+        static const int VIRTUAL_LOSS = 3;         // Penalty applied while a playout is in flight
+        static constexpr float C_PUCT = 1.5f;      // Exploration constant
+        static constexpr float EVAL_SCALE = 5000.0f; // Static eval -> value squashing
+
+        enum NodeState : uint8_t {
+            LEAF = 0,
+            EXPANDING = 1,
+            EXPANDED = 2
+        };
+
+        enum class LeafAction {
+            TERMINAL, // Won position, no evaluation needed
+            EXPAND,   // Unexpanded node: create children and evaluate
+            EVALUATE  // Nothing to expand, static evaluation only
+        };
+
+        // Tree node, allocated from a fixed pool. Children are contiguous.
+        // valueSum is seen from the player who played `move` into this node.
+        struct Node {
+            std::atomic<int32_t> visits;
+            std::atomic<float> valueSum;
+            std::atomic<int32_t> firstChild;
+            float prior;
+            int16_t childCount;
+            int16_t move;
+            std::atomic<uint8_t> state;
+            bool terminal;
+        };
+        // The pool counts toward the memory cap: keep the two in step
+        static_assert(sizeof(Node) * NODE_POOL_SIZE <= static_cast<size_t>(POOL_SIZE_MB) << 20,
+                      "POOL_SIZE_MB is the node pool's budget");
+
+        // Nodes visited by one playout, root first
+        struct Path {
+            std::array<int32_t, N * N + 1> nodes;
+            int length;
+        };
+
+        // Scored moves of a node being expanded (score, packed move)
+        struct CandidateList {
+            std::array<std::pair<int, int16_t>, N * N> entries;
+            int count;
+            bool canWin;
+            int opponentWins;
+        };
+
+        // Deterministic mode: one in-flight playout per thread
+        struct PlayoutSlot {
+            Board<N> board;
+            Path path;
+            Cell toMove;
+            LeafAction action;
+            CandidateList candidates;
+            float leafValue;
+        };
+
+        // Node pool allocator
+        std::unique_ptr<Node[]> pool;
+        std::atomic<int32_t> poolUsed;
+
+        // Tree state (kept between moves for tree reuse)
+        int32_t rootIndex;
+        Board<N> rootBoard;
+        Cell rootColor;
+
+        // Search state
+        int threadCount;
+        std::atomic<int64_t> playouts;
+        std::atomic<bool> stopSearch;
+        std::chrono::steady_clock::time_point deadline;
+        bool hasDeadline;
+        int64_t maxPlayouts;
+
+        // Pool management
+        int32_t allocateNodes(int count);
+        void initNode(Node& node, int16_t move, float prior, bool terminal);
+        void resetTree(const Board<N>& board, Cell myColor);
+        bool reuseTree(const Board<N>& board, Cell myColor);
+
+        // Playout steps
+        void searchWorker(const Board<N>& board);
+        void deterministicSearch(const Board<N>& board);
+        bool budgetExhausted() const;
+        void playout(Board<N>& board);
+        LeafAction selectLeaf(Board<N>& board, Path& path, Cell& toMove);
+        void backpropagate(Board<N>& board, const Path& path, float value);
+        int32_t selectChild(const Node& node) const;
+        int32_t mostVisitedChild(const Node& node) const;
+        bool expand(Node& node, Board<N>& board, Cell toMove, float& leafValue);
+        void scoreCandidates(Board<N>& board, Cell toMove, CandidateList& candidates, float& leafValue) const;
+        bool createChildren(Node& node, CandidateList& list);
+        float evaluateLeaf(const Board<N>& board, Cell toMove) const;
+
+        // Helpers
+        static int16_t packMove(Move move) { return static_cast<int16_t>(move.second * N + move.first); }
+        static Move unpackMove(int16_t move) { return Move(move % N, move / N); }
+
+    public:
+        // Constructor
+        MCTS();
+
+        // Main interface (same contract as AI<N>::findBestMove). limits.nodes
+        // counts playouts; without a time limit the search is deterministic
+        // for any thread count.
+        Move findBestMove(const Board<N>& board, Cell myColor, const SearchLimits& limits,
+                          std::chrono::steady_clock::time_point startTime);
+
+        // Configuration
+        void setThreads(int threads);
+        void clear();
+
+        // Result of the last search: most visited line, and the value of its
+        // first move mapped back to evaluation units
+        void getPrincipalVariation(std::vector<Move>& pv, int maxLength) const;
+        int getScore() const;
+
+        // Statistics
+        int64_t getPlayouts() const { return playouts.load(); }
+        int getTreeSize() const { return (poolUsed.load() < NODE_POOL_SIZE) ? poolUsed.load() : NODE_POOL_SIZE; }
+};
+
+#endif // MCTS_HPP
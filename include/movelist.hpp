@@ -0,0 +1,89 @@
+#ifndef MOVELIST_HPP
+#define MOVELIST_HPP
+
+#include <array>
+#include <cstdint>
+#include "board.hpp"
+
+// Fixed-capacity move list for the search: moves packed on 16 bits
+// ((y << 5) | x, independent of the board size) plus one score each. Lives on the stack or in the per-ply
+// search stack and never allocates.
+class MoveList {
+    public:
+        static const int CAPACITY = MAX_BOARD_SIZE * MAX_BOARD_SIZE;
+
+    private:
+        std::array<uint16_t, CAPACITY> moves;
+        std::array<int32_t, CAPACITY> scores;
+        int count;
+
+    public:
+        MoveList() : count(0) {}
+
+        // Packing
+        static uint16_t pack(Move move) { return static_cast<uint16_t>((move.second << 5) | move.first); }
+        static Move unpack(uint16_t packed) { return Move(packed & 31, packed >> 5); }
+
+        // Content
+        void clear() { count = 0; }
+        void add(Move move, int score = 0) {
+            moves[count] = pack(move);
+            scores[count] = score;
+            count++;
+        }
+        int size() const { return count; }
+        bool empty() const { return count == 0; }
+        void truncate(int newSize) {
+            if (newSize < count) {
+                count = newSize;
+            }
+        }
+
+        // Access
+        Move operator[](int index) const { return unpack(moves[index]); }
+        int getScore(int index) const { return scores[index]; }
+        void setScore(int index, int score) { scores[index] = score; }
+
+        // Reordering
+        void swap(int a, int b) {
+            std::swap(moves[a], moves[b]);
+            std::swap(scores[a], scores[b]);
+        }
+        int indexOf(Move move) const {
+            uint16_t packed = pack(move);
+            for (int i = 0; i < count; i++) {
+                if (moves[i] == packed) {
+                    return i;
+                }
+            }
+            return -1;
+        }
+        // Move entry `index` to the front, keeping the others in order
+        void moveToFront(int index) {
+            uint16_t move = moves[index];
+            int32_t score = scores[index];
+            for (int i = index; i > 0; i--) {
+                moves[i] = moves[i - 1];
+                scores[i] = scores[i - 1];
+            }
+            moves[0] = move;
+            scores[0] = score;
+        }
+        // Stable sort by score, highest first (insertion sort, lists are short)
+        void sortByScore() {
+            for (int i = 1; i < count; i++) {
+                uint16_t move = moves[i];
+                int32_t score = scores[i];
+                int j = i;
+                while (j > 0 && scores[j - 1] < score) {
+                    moves[j] = moves[j - 1];
+                    scores[j] = scores[j - 1];
+                    j--;
+                }
+                moves[j] = move;
+                scores[j] = score;
+            }
+        }
+};
+
+#endif // MOVELIST_HPP
@@ -0,0 +1,87 @@
+#ifndef MOVEPICKER_HPP
+#define MOVEPICKER_HPP
+
+#include <array>
+#include <cstdint>
+#include "board.hpp"
+#include "movelist.hpp"
+
+// Staged, lazy move generation for AI<N>::search. Moves come out in this order:
+// TT move, winning moves, forced blocks, four-makers, killers, then the rest
+// scored (heuristic + history) only when that stage is reached and picked by
+// selection sort. In forcing positions (see restrictToForced) only the
+// forced replies are generated.
+// Late-move pruning: past quietLimit killers / quiet moves, only forcing
+// moves (fours, open threes, blocks of a four) still come out. Tactical
+// stages and forced lists are never cut.
+// Most nodes cut off after one or two moves and never score the quiet ones.
+template <int N>
+class MovePicker {
+    private:
+        enum class Stage {
+            CLASSIFY,
+            TT_MOVE,
+            WINNING,
+            BLOCKS,
+            FOURS,
+            KILLERS,
+            SCORE_QUIET,
+            QUIET,
+            DONE
+        };
+
+        // Tactical classes, computed in one cheap pass
+        enum : uint8_t {
+            WINS = 1,
+            BLOCKS_WIN = 2,
+            MAKES_FOUR = 4,
+            FORCING = 8 // Four, open three, or a block of the opponent's four
+        };
+
+        const Board<N>& board;
+        Cell player;
+        Cell opponent;
+        Move ttMove;
+        std::array<Move, 2> killers;
+        const int* history; // Per-cell cutoff counts for player, may be null
+
+        Stage stage;
+        MoveList& candidates; // Caller-owned scratch (per-ply search stack)
+        std::array<uint8_t, MoveList::CAPACITY> flags;
+        int cursor;
+        int killerIndex;
+        int quietCount; // Killers and quiet moves returned so far
+        int quietLimit;
+        std::array<bool, N * N> picked;
+        bool forced; // Candidates were cut down to the forced replies
+
+        bool isPicked(Move move) const { return picked[move.second * N + move.first]; }
+        bool emit(Move candidate, Move& move);
+        void classify();
+        bool nextWithFlag(uint8_t flag, Move& move);
+        static bool defends(const Board<N>& board, Cell opponent, Move move,
+                            const Move* straightFours, int count);
+
+    public:
+        MovePicker(const Board<N>& board, Cell player, MoveList& moves,
+                   Move ttMove, const std::array<Move, 2>& killers,
+                   const int* history, int quietLimit);
+
+        // Next move to search, false when exhausted
+        bool next(Move& move);
+        int getQuietCount() const { return quietCount; }
+
+        // Whether a move threatens or parries something: never pruned
+        static bool isForcing(const Board<N>& board, Move move, Cell player);
+
+        // Full heuristic score used for quiet moves and root ordering
+        static int scoreMove(const Board<N>& board, Move move, Cell player);
+
+        // Keep only the forced replies for player: a win if there is one,
+        // else blocks of the opponent's five, else, against an open three,
+        // the moves that leave it no straight four plus our own fours.
+        // Returns false (moves untouched) when nothing is forced.
+        static bool restrictToForced(const Board<N>& board, Cell player, MoveList& moves);
+};
+
+#endif // MOVEPICKER_HPP
@@ -0,0 +1,101 @@
+#ifndef NNUE_HPP
+#define NNUE_HPP
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "board.hpp"
+
+// Efficiently updatable evaluation network, evaluated with integers only:
+//
+//   features  2 * N * N one-hot inputs per perspective: own stone on a cell,
+//             opponent stone on a cell
+//   layer 0   int16, features -> NNUE_ACCUMULATOR_SIZE. Kept in the Board
+//             for both perspectives, a stone adds or subtracts one column.
+//   layer 1   clipped ReLU [0, 127] as uint8, side to move first, then
+//             int8 weights -> HIDDEN_SIZE, clipped ReLU again
+//   output    int8 weights -> 1, a score from the side to move
+//
+// Weights come from an embedded base64 blob (nnue_weights.cpp, written by
+// gomoku-nnue-train). Sizes without a blob have no network: isAvailable()
+// is false and the accumulator is left alone.
+template <int N>
+class Nnue {
+    public:
+        static constexpr int ACCUMULATOR_SIZE = NNUE_ACCUMULATOR_SIZE;
+        static constexpr int FEATURE_COUNT = 2 * N * N;
+        static constexpr int HIDDEN_SIZE = 32;
+        static constexpr int WEIGHT_SHIFT = 6;      // int8 weights are real weights * 64
+        static constexpr int ACTIVATION_MAX = 127;  // Clipped ReLU, 1.0 == 127
+        static constexpr int OUTPUT_SCALE = 4000;   // Score of one logit (pattern score units)
+
+        struct Weights {
+            std::vector<int16_t> featureWeights;     // [feature][ACCUMULATOR_SIZE]
+            std::array<int16_t, ACCUMULATOR_SIZE> featureBias{};
+            alignas(32) std::array<int8_t, HIDDEN_SIZE * 2 * ACCUMULATOR_SIZE> hiddenWeights{};
+            std::array<int32_t, HIDDEN_SIZE> hiddenBias{};
+            std::array<int8_t, HIDDEN_SIZE> outputWeights{};
+            int32_t outputBias = 0;
+            bool loaded = false;
+        };
+
+    private:
+        static Weights network;
+
+    public:
+        static bool isAvailable() { return network.loaded; }
+
+        // Accumulator maintenance (Board::clear / placeStone / removeStone)
+        static void resetAccumulator(NnueAccumulator& accumulator);
+        static void addStone(NnueAccumulator& accumulator, int cell, int color) {
+            if (network.loaded) {
+                updateStone<1>(accumulator, cell, color);
+            }
+        }
+        static void removeStone(NnueAccumulator& accumulator, int cell, int color) {
+            if (network.loaded) {
+                updateStone<-1>(accumulator, cell, color);
+            }
+        }
+
+        // Score from the side to move, in pattern score units
+        static int evaluate(const NnueAccumulator& accumulator, Cell sideToMove);
+        static int evaluate(const Board<N>& board, Cell sideToMove) {
+            return evaluate(board.getAccumulator(), sideToMove);
+        }
+
+        // Blob (de)serialization, and a replacement network for the trainer.
+        // Boards must be cleared after setWeights.
+        static bool decodeBlob(const char* base64, Weights& weights);
+        static std::string encodeBlob(const Weights& weights);
+        static void setWeights(const Weights& weights) { network = weights; }
+        static const char* getForwardName();
+
+    private:
+        template <int SIGN>
+        static void updateStone(NnueAccumulator& accumulator, int cell, int color) {
+            const int16_t* own = &network.featureWeights[cell * ACCUMULATOR_SIZE];
+            const int16_t* opponent = &network.featureWeights[(N * N + cell) * ACCUMULATOR_SIZE];
+            int16_t* same = accumulator.values[color].data();
+            int16_t* other = accumulator.values[1 - color].data();
+            for (int i = 0; i < ACCUMULATOR_SIZE; i++) {
+                same[i] = static_cast<int16_t>(SIGN > 0 ? same[i] + own[i] : same[i] - own[i]);
+                other[i] = static_cast<int16_t>(SIGN > 0 ? other[i] + opponent[i] : other[i] - opponent[i]);
+            }
+        }
+};
+
+// Embedded networks, one per board size (generated file)
+struct NnueBlob {
+    int boardSize;
+    const char* base64;
+};
+
+extern const NnueBlob NNUE_BLOBS[];
+extern const int NNUE_BLOB_COUNT;
+
+extern template class Nnue<15>;
+extern template class Nnue<20>;
+
+#endif // NNUE_HPP
@@ -2,6 +2,7 @@
 #define PATTERN_HPP
 
 #include "board.hpp"
+#include "pattern_weights.hpp"
 #include <vector>
 
 // Pattern types and their scores
@@ -16,35 +17,72 @@ enum class PatternType {
     ONE             // X
 };
 
+static const int PATTERN_TYPE_COUNT = 8;
+
+static_assert(sizeof(PATTERN_WEIGHTS) / sizeof(PATTERN_WEIGHTS[0]) == PATTERN_TYPE_COUNT,
+              "one weight per pattern type");
+
+// Exact class of a move for the player making it, strongest first.
+// Combinations count directions of the threat map.
+enum class MoveThreat {
+    FIVE,
+    STRAIGHT_FOUR,  // Two completions on one line
+    DOUBLE_FOUR,    // Fours on two lines
+    FOUR_THREE,     // A four and an open three
+    DOUBLE_THREE,   // Open threes on two lines
+    FOUR,
+    OPEN_THREE,
+    THREE,
+    NONE
+};
+
 struct Pattern {
     PatternType type;
     int count;
     int score;
 };
 
+// Pattern analysis for a Board<N> (instantiated for every supported size)
+template <int N>
 class PatternDetector {
     public:
         // Pattern detection
-        static Pattern analyzePosition(const Board& board, int x, int y, Cell player);
-        static int countPattern(const Board& board, int x, int y, int dx, int dy, Cell player, int length);
+        static Pattern analyzePosition(const Board<N>& board, int x, int y, Cell player);
+        static int countPattern(const Board<N>& board, int x, int y, int dx, int dy, Cell player, int length);
 
-        // Advanced pattern detection
-        static bool hasOpenFour(const Board& board, int x, int y, Cell player);
-        static bool hasOpenThree(const Board& board, int x, int y, Cell player);
-        static bool hasFour(const Board& board, int x, int y, Cell player);
-        static bool hasThree(const Board& board, int x, int y, Cell player);
+        // Advanced pattern detection (threat map reads)
+        static MoveThreat classifyMove(const Board<N>& board, int x, int y, Cell player);
+        static bool hasOpenFour(const Board<N>& board, int x, int y, Cell player);
+        static bool hasOpenThree(const Board<N>& board, int x, int y, Cell player);
+        static bool hasFour(const Board<N>& board, int x, int y, Cell player);
+        static bool hasThree(const Board<N>& board, int x, int y, Cell player);
 
         // Pattern scoring
         static int getPatternScore(PatternType type);
-        static int evaluatePatterns(const Board& board, Cell player);
 
-        // Threat detection
-        static bool isDoubleThreat(const Board& board, int x, int y, Cell player);
-        static std::vector<Move> findThreats(const Board& board, Cell player);
+        // Whole-board evaluation of both colors in one pass over the line
+        // masks, computed by the SIMD kernel
+        static void evaluateBoard(const Board<N>& board, int& blackScore, int& whiteScore);
+        static void countLinePatterns(const Board<N>& board, int counts[2][PATTERN_TYPE_COUNT]);
+        static const char* getKernelName();
+
+        // evaluateBoard from COLOR's side, opponent weighted by DEFENSE_WEIGHT:
+        // the color is fixed at compile time, so there is no branch and no sign flip
+        template <Cell COLOR>
+        static int evaluateFor(const Board<N>& board) {
+            constexpr int US = (COLOR == Cell::BLACK) ? 0 : 1;
+            int scores[2] = {0, 0}; // Black, white
+            evaluateBoard(board, scores[0], scores[1]);
+            return static_cast<int>(scores[US] - (scores[1 - US] * DEFENSE_WEIGHT));
+        }
+
+        // Threat detection: double-four, four-three or double open three
+        static bool isDoubleThreat(const Board<N>& board, int x, int y, Cell player);
+        static std::vector<Move> findThreats(const Board<N>& board, Cell player);
 
         // Helper functions
-        static int analyzeDirection(const Board& board, int x, int y, int dx, int dy, Cell player);
-        static bool isOpen(const Board& board, int x, int y);
+        static int analyzeDirection(const Board<N>& board, int x, int y, int dx, int dy, Cell player);
+        static bool isOpen(const Board<N>& board, int x, int y);
 };
 
 #endif // PATTERN_HPP
@@ -0,0 +1,11 @@
+#ifndef PATTERN_WEIGHTS_HPP
+#define PATTERN_WEIGHTS_HPP
+
+// Evaluation weights: pattern scores in PatternType order (FIVE first) and
+// the weight of the opponent's patterns (defense). Hand-picked values;
+// gomoku-tune (make tune) fits them on game records and rewrites this file.
+
+inline constexpr int PATTERN_WEIGHTS[] = {100000, 10000, 5000, 1000, 500, 100, 50, 10};
+inline constexpr double DEFENSE_WEIGHT = 1.1;
+
+#endif // PATTERN_WEIGHTS_HPP
@@ -4,8 +4,7 @@
 #include <iostream>
 #include <string>
 #include <vector>
-#include "board.hpp"
-#include "ai.hpp"
+#include "engine.hpp"
 
 class ProtocolHandler {
     private:
@@ -15,8 +14,14 @@ class ProtocolHandler {
         // Constructor
         ProtocolHandler();
 
+        // Game recording, appended to path (returns false if it cannot be opened)
+        bool setRecordFile(const std::string& path);
+
+        // Experience file, loaded now and rewritten at END (false if unreadable)
+        bool setExperienceFile(const std::string& path);
+
         // Main communication loop
-        void runCommunicationLoop(Board& board, AI& ai);
+        void runCommunicationLoop(const EngineOptions& options);
 
         // Command handlers
         void handleStart(int boardSize);
@@ -27,6 +32,14 @@ class ProtocolHandler {
         void handleAbout();
         void handleEnd();
         void handleRestart();
+        void playMove();
+
+        // Game record
+        void recordMove(int x, int y, Cell stone, const SearchInfo* info, int timeMs);
+        void finishRecord();
+
+        // Move latency (read -> flush) of the game, sent at END
+        void reportLatency();
 
         // Response functions
         void sendMove(int x, int y);
@@ -0,0 +1,22 @@
+#ifndef SEARCHLIMITS_HPP
+#define SEARCHLIMITS_HPP
+
+#include <cstdint>
+
+// Budget for one findBestMove call (INFO max_depth / max_nodes / max_time_ms
+// or the GOMOKU_MAX_* environment variables). 0 means "no limit".
+// Without a time limit nothing depends on the clock or on thread scheduling,
+// so the same position and game history always give the same move.
+struct SearchLimits {
+    static constexpr int DEFAULT_DEPTH = 6;      // Alpha-beta iterative deepening
+    static constexpr int DEFAULT_TIME_MS = 4900; // Stay under 5 seconds
+    static constexpr int MAX_DEPTH = 20;         // Hard cap (search stack size)
+
+    int depth = DEFAULT_DEPTH;    // Alpha-beta only, 0 = MAX_DEPTH
+    int64_t nodes = 0;            // Alpha-beta nodes or MCTS playouts
+    int timeMs = DEFAULT_TIME_MS;
+
+    bool isDeterministic() const { return timeMs == 0; }
+};
+
+#endif // SEARCHLIMITS_HPP
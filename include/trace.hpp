@@ -0,0 +1,100 @@
+#ifndef TRACE_HPP
+#define TRACE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+// Hot-path tracing. TRACE_EVENT(event, a, b, c) stores a fixed-size binary
+// record (timestamp, thread, event, three integers) in a ring buffer owned
+// by the calling thread: no lock, no allocation, no I/O. A background thread
+// drains the rings to a file or stderr as text lines
+//
+//   <nanoseconds> <thread> <event> <a> <b> <c>
+//
+// A full ring drops records (counted) rather than wait. Tracing only exists
+// in builds with GOMOKU_TRACE (make trace); elsewhere TRACE_EVENT expands to
+// nothing and its arguments are not evaluated.
+
+enum class TraceEvent : uint16_t {
+    SEARCH_START, // stones on the board, depth limit, time limit (ms)
+    ITERATION,    // depth, score, nodes
+    SEARCH_END,   // move x, move y, nodes
+    NODE,         // ply, depth, beta
+    TT_CUTOFF,    // ply, depth, score
+    PROBCUT,      // ply, depth, reduced score
+    CUTOFF,       // ply, depth, quiet moves searched
+    COUNT
+};
+
+struct TraceRecord {
+    uint64_t time; // Steady clock, nanoseconds
+    uint16_t event;
+    uint16_t thread;
+    int32_t args[3];
+};
+
+class Trace {
+    public:
+        static const int RING_SIZE = 1 << 16; // Records per thread, power of two
+        static const int MAX_THREADS = 64;
+
+        // Single producer (the owning thread), single consumer (the drain)
+        struct Ring {
+            TraceRecord records[RING_SIZE];
+            alignas(64) std::atomic<uint32_t> head{0}; // Next write, producer side
+            alignas(64) std::atomic<uint32_t> tail{0}; // Next read, drain side
+            std::atomic<uint64_t> dropped{0}; // Written by the producer only
+            uint16_t thread = 0;
+        };
+
+        // Start the drain thread ("-" = stderr). False when the file cannot be
+        // opened or tracing is compiled out.
+        static bool start(const std::string& path);
+
+        // Drain what is left and stop (also run at exit)
+        static void stop();
+
+        static bool isEnabled() { return enabled.load(std::memory_order_relaxed); }
+        static const char* getEventName(TraceEvent event);
+
+        static void record(TraceEvent event, int32_t a, int32_t b, int32_t c) {
+            if (!isEnabled()) {
+                return;
+            }
+            Ring* ring = getRing();
+            if (!ring) {
+                return;
+            }
+
+            uint32_t head = ring->head.load(std::memory_order_relaxed);
+            if (head - ring->tail.load(std::memory_order_acquire) >= RING_SIZE) {
+                ring->dropped.store(ring->dropped.load(std::memory_order_relaxed) + 1,
+                                    std::memory_order_relaxed);
+                return;
+            }
+            TraceRecord& slot = ring->records[head & (RING_SIZE - 1)];
+            slot.time = now();
+            slot.event = static_cast<uint16_t>(event);
+            slot.thread = ring->thread;
+            slot.args[0] = a;
+            slot.args[1] = b;
+            slot.args[2] = c;
+            ring->head.store(head + 1, std::memory_order_release);
+        }
+
+    private:
+        static std::atomic<bool> enabled;
+
+        static uint64_t now();
+        static Ring* getRing(); // This thread's ring, registered on first use
+};
+
+#ifdef GOMOKU_TRACE
+#define TRACE_EVENT(event, a, b, c) \
+    Trace::record(TraceEvent::event, static_cast<int32_t>(a), static_cast<int32_t>(b), static_cast<int32_t>(c))
+#else
+#define TRACE_EVENT(event, a, b, c) do {} while (0)
+#endif
+
+#endif // TRACE_HPP
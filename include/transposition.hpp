@@ -0,0 +1,66 @@
+#ifndef TRANSPOSITION_HPP
+#define TRANSPOSITION_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "board.hpp"
+
+// Score bound stored with an entry
+enum class Bound : uint8_t {
+    NONE = 0,
+    EXACT = 1,
+    LOWER = 2, // Fail high: score >= stored
+    UPPER = 3  // Fail low: score <= stored
+};
+
+struct TTEntry {
+    uint64_t key;
+    int32_t score;
+    int16_t move;      // Packed (y << 5) | x, -1 if none
+    int8_t depth;
+    uint8_t boundAge;  // Bound in the low 2 bits, search age above
+};
+
+// Fixed-size, direct-mapped transposition table. Lives for a whole game:
+// entries from earlier turns stay usable, and the age lets fresh results
+// replace stale ones regardless of depth. Entries preloaded from earlier
+// games (ExperienceStore) carry a reserved age: any new result replaces
+// them, and they are not collected again unless searched again.
+class TranspositionTable {
+    public:
+        static const int DEFAULT_SIZE_MB = 16;
+
+    private:
+        static const uint8_t PRELOAD_AGE = 0x3f; // Never the age of a search
+
+        std::vector<TTEntry> entries;
+        uint64_t mask;
+        uint8_t age;
+
+    public:
+        // Constructor
+        TranspositionTable();
+
+        // Table management
+        void resize(int megabytes);
+        void clear();
+        void newSearch();
+
+        // Lookup / update
+        bool probe(uint64_t key, TTEntry& entry) const;
+        void store(uint64_t key, int depth, int score, Bound bound, Move move);
+
+        // Experience: fill empty slots before a game, collect this game's deep entries
+        void preload(const TTEntry& entry);
+        void collectSearched(int minDepth, std::vector<TTEntry>& out) const;
+
+        // Helpers
+        static Bound getBound(const TTEntry& entry) { return static_cast<Bound>(entry.boundAge & 3); }
+        static Move getMove(const TTEntry& entry) {
+            return (entry.move < 0) ? Move(-1, -1) : Move(entry.move & 31, entry.move >> 5);
+        }
+        size_t getSize() const { return entries.size(); }
+};
+
+#endif // TRANSPOSITION_HPP
@@ -23,7 +23,7 @@ int getRandomInt(int min, int max);
 bool patternMatch(const std::string& text, const std::string& pattern);
 
 // Validation helpers
-bool isValidCoordinate(int x, int y);
+bool isValidCoordinate(int x, int y, int boardSize);
 bool isValidBoardSize(int size);
 
 // Platform-specific helpers
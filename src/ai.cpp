@@ -1,45 +1,95 @@
 #include "ai.hpp"
+#include "trace.hpp"
 #include <algorithm>
 #include <limits>
 
-AI::AI() : nodesEvaluated(0) {
-    resetSearchStats();
-}
-
-// Get opponent's color
-Cell AI::getOpponentColor(Cell player) const {
-    return (player == Cell::BLACK) ? Cell::WHITE : Cell::BLACK;
+template <int N>
+AI<N>::AI()
+    : nodesEvaluated(0), nextCheck(0), softStop(false), stopSearch(false),
+      expectedHash(0), rootMove(-1, -1), lastScore(0), lastDepth(0), searchMode(SearchMode::ALPHA_BETA),
+      evaluation(Evaluation::PATTERNS), pruningStats(nullptr) {
+    principalVariation.reserve(SearchLimits::MAX_DEPTH);
+    newGame();
 }
 
 // Main entry point - finds best move using Minimax with Alpha-Beta
-Move AI::findBestMove(const Board& board, Cell myColor) {
+template <int N>
+Move AI<N>::findBestMove(const Board<N>& board, Cell myColor) {
     resetSearchStats();
+    transpositionTable.newSearch();
     startTime = std::chrono::steady_clock::now();
+    lastScore = 0;
+    lastDepth = 0;
+    iterations.clear();
+    TRACE_EVENT(SEARCH_START, board.getMoveCount(), limits.depth, limits.timeMs);
     
     // Check for immediate win
     Move winMove = findImmediateWin(board, myColor);
     if (winMove.first != -1) {
+        setForcedResult(board, winMove, myColor);
         return winMove;
     }
     
     // Check for immediate threat to block
-    Cell opponent = getOpponentColor(myColor);
+    Cell opponent = opponentOf(myColor);
     Move threatMove = findImmediateWin(board, opponent);
     if (threatMove.first != -1) {
+        setForcedResult(board, threatMove, myColor);
         return threatMove;
     }
     
+    // Quiet position: hand over to the selected engine
+    if (searchMode == SearchMode::MCTS) {
+        Move move = mcts.findBestMove(board, myColor, limits, startTime);
+        mcts.getPrincipalVariation(principalVariation, SearchLimits::MAX_DEPTH);
+        lastScore = mcts.getScore();
+        lastDepth = static_cast<int>(principalVariation.size());
+        return move;
+    }
+
     // Use iterative deepening with alpha-beta
-    return iterativeDeepening(board, myColor);
+    setRootColor(myColor);
+    Move move = iterativeDeepening(board, myColor);
+    TRACE_EVENT(SEARCH_END, move.first, move.second, nodesEvaluated);
+    return move;
+}
+
+// Search info for a move played without searching (win or forced block)
+template <int N>
+void AI<N>::setForcedResult(const Board<N>& board, Move move, Cell myColor) {
+    Board<N> tempBoard = board;
+    tempBoard.placeStone(move.first, move.second, myColor);
+    
+    lastScore = tempBoard.checkWin(move.first, move.second, myColor)
+                ? WIN_SCORE : evaluatePositionAdvanced(tempBoard, myColor);
+    lastDepth = 1;
+    principalVariation.assign(1, move);
+    expectedHash = 0;
+}
+
+// Root moves for a split search: none when findBestMove answers without
+// searching (a win, a forced block, a single candidate, MCTS)
+template <int N>
+bool AI<N>::getRootMoves(const Board<N>& board, Cell myColor, MoveList& moves) {
+    moves.clear();
+    if (searchMode == SearchMode::MCTS ||
+        findImmediateWin(board, myColor).first != -1 ||
+        findImmediateWin(board, opponentOf(myColor)).first != -1) {
+        return false;
+    }
+    getOrderedMovesAdvanced(board, myColor, moves);
+    return moves.size() > 1;
 }
 
 // Find immediate winning move
-Move AI::findImmediateWin(const Board& board, Cell myColor) {
-    auto moves = getRelevantMoves(board);
+template <int N>
+Move AI<N>::findImmediateWin(const Board<N>& board, Cell myColor) {
+    MoveList moves;
+    getRelevantMoves(board, moves);
     
-    for (const auto& move : moves) {
-        if (isWinningMove(board, move, myColor)) {
-            return move;
+    for (int i = 0; i < moves.size(); i++) {
+        if (isWinningMove(board, moves[i], myColor)) {
+            return moves[i];
         }
     }
     
@@ -47,145 +97,377 @@ Move AI::findImmediateWin(const Board& board, Cell myColor) {
 }
 
 // Find immediate threat
-Move AI::findImmediateThreat(const Board& board, Cell myColor) {
-    Cell opponent = getOpponentColor(myColor);
+template <int N>
+Move AI<N>::findImmediateThreat(const Board<N>& board, Cell myColor) {
+    Cell opponent = opponentOf(myColor);
     return findImmediateWin(board, opponent);
 }
 
 // Iterative deepening with time management
-Move AI::iterativeDeepening(const Board& board, Cell myColor) {
+template <int N>
+Move AI<N>::iterativeDeepening(const Board<N>& board, Cell myColor) {
     Move bestMove(-1, -1);
     
     // Get candidate moves once
-    auto moves = getOrderedMovesAdvanced(board, myColor);
+    MoveList& moves = searchStack[0].moves;
+    bool closed = getOrderedMovesAdvanced(board, myColor, moves);
     
     if (moves.empty()) {
-        return Move(10, 10); // Center fallback
+        return Move(Board<N>::CENTER, Board<N>::CENTER); // Center fallback
     }
     
-    if (moves.size() == 1) {
+    // A cluster worker searches its share of the root moves, even a single one
+    if (!rootFilter.empty()) {
+        closed = true;
+        moves.clear();
+        for (const Move& move : rootFilter) {
+            if (board.isValidMove(move.first, move.second)) {
+                moves.add(move);
+            }
+        }
+        if (moves.empty()) {
+            return Move(-1, -1);
+        }
+    } else if (moves.size() == 1) {
         return moves[0];
     }
     
-    // Try increasing depths until time runs out
-    for (int depth = 2; depth <= MAX_DEPTH; depth++) {
-        if (isTimeUp()) break;
-        
-        int alpha = std::numeric_limits<int>::min();
-        int beta = std::numeric_limits<int>::max();
-        Move currentBest = bestMove;
-        int currentBestScore = std::numeric_limits<int>::min();
+    // What earlier turns already know about this position goes first
+    seedRootMoves(board, moves, closed);
+    
+    // Try increasing depths until the depth limit or the budget is reached
+    int maxDepth = (limits.depth > 0) ? std::min(limits.depth, SearchLimits::MAX_DEPTH)
+                                      : SearchLimits::MAX_DEPTH;
+    for (int depth = std::min(2, maxDepth); depth <= maxDepth; depth++) {
+        // A new iteration would not finish before the hard deadline
+        checkLimits();
+        if (isStopped() || (softStop && bestMove.first != -1)) break;
         
-        for (const auto& move : moves) {
-            if (isTimeUp()) break;
-            
-            Board tempBoard = board;
-            tempBoard.placeStone(move.first, move.second, myColor);
-            
-            int score = -alphaBeta(tempBoard, depth - 1, -beta, -alpha, 
-                                   myColor, getOpponentColor(myColor));
-            
-            if (score > currentBestScore) {
-                currentBestScore = score;
-                currentBest = move;
-            }
-            
-            alpha = std::max(alpha, score);
-        }
+        // The root color is fixed once here: everything below is specialized
+        Board<N> rootBoard = board;
+        int score = (myColor == Cell::BLACK)
+            ? search<NodeType::ROOT, Cell::BLACK, Cell::BLACK>(rootBoard, depth, -INF_SCORE, INF_SCORE, 0)
+            : search<NodeType::ROOT, Cell::WHITE, Cell::WHITE>(rootBoard, depth, -INF_SCORE, INF_SCORE, 0);
         
         // Only update if we completed this depth
-        if (!isTimeUp()) {
-            bestMove = currentBest;
+        if (!isStopped()) {
+            bestMove = rootMove;
+            lastScore = score;
+            lastDepth = depth;
+            iterations.push_back(IterationResult{depth, bestMove, score});
+            TRACE_EVENT(ITERATION, depth, score, nodesEvaluated);
+            updatePrincipalVariation(board, myColor, depth);
+            
+            // Best move first in the next iteration
+            moves.moveToFront(moves.indexOf(bestMove));
         }
     }
     
     return (bestMove.first != -1) ? bestMove : moves[0];
 }
 
-// Alpha-Beta pruning implementation (Negamax variant)
-int AI::alphaBeta(Board& board, int depth, int alpha, int beta, 
-                  Cell maximizingPlayer, Cell currentPlayer) {
+// Put the expected PV move (if the opponent followed the previous PV) or the
+// stored TT move at the front of the root moves (a closed list only reorders)
+template <int N>
+void AI<N>::seedRootMoves(const Board<N>& board, MoveList& moves, bool closed) {
+    Move seed(-1, -1);
+    TTEntry entry;
+    int symmetry;
+    
+    if (principalVariation.size() >= 3 && board.getHash() == expectedHash) {
+        seed = principalVariation[2];
+    } else if (transpositionTable.probe(hashBoard(board, symmetry), entry)) {
+        seed = Board<N>::Symmetry::invert(TranspositionTable::getMove(entry), symmetry);
+    }
+    
+    if (!board.isValidMove(seed.first, seed.second)) {
+        return;
+    }
+    
+    int index = moves.indexOf(seed);
+    if (index < 0 && closed) {
+        return;
+    }
+    if (index < 0) {
+        moves.add(seed);
+        index = moves.size() - 1;
+    }
+    moves.moveToFront(index);
+}
+
+// Follow the best moves stored in the TT from the root
+template <int N>
+void AI<N>::updatePrincipalVariation(const Board<N>& board, Cell myColor, int depth) {
+    principalVariation.clear();
+    expectedHash = 0;
+    
+    Board<N> tempBoard = board;
+    Cell player = myColor;
+    TTEntry entry;
+    int symmetry;
+    
+    while (static_cast<int>(principalVariation.size()) < depth &&
+           transpositionTable.probe(hashBoard(tempBoard, symmetry), entry)) {
+        Move move = Board<N>::Symmetry::invert(TranspositionTable::getMove(entry), symmetry);
+        if (!tempBoard.isValidMove(move.first, move.second)) {
+            break;
+        }
+        
+        tempBoard.placeStone(move.first, move.second, player);
+        principalVariation.push_back(move);
+        player = opponentOf(player);
+        
+        if (principalVariation.size() == 2) {
+            expectedHash = tempBoard.getHash();
+        }
+    }
+}
+
+// Alpha-beta search (negamax). Node type, root color and side to move are
+// template arguments, so color tests and the evaluation sign are resolved at
+// compile time. PV nodes search their first move with the full window and the
+// others with a null window, searched again as PV only when they beat alpha.
+template <int N>
+template <NodeType NODE_TYPE, Cell ROOT_COLOR, Cell US>
+int AI<N>::search(Board<N>& board, int depth, int alpha, int beta, int ply) {
+    constexpr bool ROOT_NODE = (NODE_TYPE == NodeType::ROOT);
+    constexpr bool PV_NODE = (NODE_TYPE != NodeType::NON_PV);
+    constexpr Cell THEM = opponentOf(US);
+    constexpr int COLOR_INDEX = (US == Cell::BLACK) ? 0 : 1;
+    
     nodesEvaluated++;
+    TRACE_EVENT(NODE, ply, depth, beta);
     
-    // Time check
-    if (isTimeUp()) {
-        return evaluatePositionAdvanced(board, maximizingPlayer);
+    // Limits are only checked every CHECK_INTERVAL nodes; once stopped, every
+    // node returns at once and the aborted iteration is thrown away
+    if (nodesEvaluated >= nextCheck) {
+        checkLimits();
+    }
+    if (isStopped()) {
+        return 0;
     }
     
     // Terminal conditions
     if (depth == 0) {
-        return evaluatePositionAdvanced(board, maximizingPlayer) * 
-               (currentPlayer == maximizingPlayer ? 1 : -1);
+        return evaluateLeaf<ROOT_COLOR, US>(board);
     }
     
-    // Check for win
-    for (int y = 0; y < 20 && !isTimeUp(); y++) {
-        for (int x = 0; x < 20; x++) {
-            if (board.getCell(x, y) == currentPlayer) {
-                if (board.checkWin(x, y, currentPlayer)) {
-                    return (currentPlayer == maximizingPlayer ? 100000 : -100000);
+    int symmetry;
+    uint64_t key = hashBoard(board, symmetry);
+    int originalAlpha = alpha;
+    Move ttMove(-1, -1);
+    SearchStackEntry& frame = searchStack[ply];
+    bool probCut = false;
+    int reducedScore = 0;
+    
+    // The root searches the ordered list iterativeDeepening prepared
+    if constexpr (!ROOT_NODE) {
+        // Check for a loss: only THEM, who just moved, can have made a five
+        for (int cell : board.getStones(THEM)) {
+            if (board.checkWin(cell % N, cell / N, THEM)) {
+                return -WIN_SCORE;
+            }
+        }
+        
+        // Transposition table: cutoff on a deep enough result, otherwise its move goes first
+        TTEntry entry;
+        if (transpositionTable.probe(key, entry)) {
+            ttMove = Board<N>::Symmetry::invert(TranspositionTable::getMove(entry), symmetry);
+            if (entry.depth >= depth) {
+                Bound bound = TranspositionTable::getBound(entry);
+                if (bound == Bound::EXACT ||
+                    (bound == Bound::LOWER && entry.score >= beta) ||
+                    (bound == Bound::UPPER && entry.score <= alpha)) {
+                    TRACE_EVENT(TT_CUTOFF, ply, depth, entry.score);
+                    return entry.score;
                 }
             }
         }
+        
+        // Moves are generated lazily, stage by stage
+        getRelevantMoves(board, frame.moves);
+        
+        // ProbCut: a reduced search failing high well above beta predicts the
+        // cutoff. Quiet non-PV nodes only (calibration also samples PV nodes,
+        // the ones with exact scores); the reduced search reuses this ply's frame.
+        probCut = (!PV_NODE || pruningStats) && depth >= PROBCUT_DEPTH &&
+                  std::abs(beta) < WIN_SCORE / 2 && isQuietNode<US>(board, frame.moves);
+        if (probCut) {
+            int probBeta = beta + PROBCUT_MARGIN;
+            reducedScore = pruningStats
+                ? search<NODE_TYPE, ROOT_COLOR, US>(board, depth - PROBCUT_REDUCTION,
+                                                    -INF_SCORE, INF_SCORE, ply)
+                : search<NodeType::NON_PV, ROOT_COLOR, US>(board, depth - PROBCUT_REDUCTION,
+                                                           probBeta - 1, probBeta, ply);
+            if (isStopped()) {
+                return 0;
+            }
+            if (!pruningStats && reducedScore >= probBeta) {
+                TRACE_EVENT(PROBCUT, ply, depth, reducedScore);
+                return beta;
+            }
+            getRelevantMoves(board, frame.moves);
+        }
     }
     
-    // Get ordered moves
-    auto moves = getOrderedMovesAdvanced(board, currentPlayer);
-    
-    if (moves.empty()) {
-        return evaluatePositionAdvanced(board, maximizingPlayer) * 
-               (currentPlayer == maximizingPlayer ? 1 : -1);
-    }
+    // Never advanced at the root, which walks frame.moves in order instead
+    int quietLimit = pruningStats ? MoveList::CAPACITY
+                                  : LMP_MOVES[std::min<int>(depth, std::size(LMP_MOVES) - 1)];
+    MovePicker<N> picker(board, US, frame.moves,
+                         ttMove, frame.killers, history[COLOR_INDEX].data(), quietLimit);
+    int searched = 0;
+    auto nextMove = [&](Move& move) {
+        if constexpr (ROOT_NODE) {
+            if (searched == frame.moves.size()) {
+                return false;
+            }
+            move = frame.moves[searched];
+            return true;
+        } else {
+            return picker.next(move);
+        }
+    };
     
-    int maxScore = std::numeric_limits<int>::min();
-    Cell nextPlayer = getOpponentColor(currentPlayer);
+    int maxScore = -INF_SCORE;
+    Move bestMove(-1, -1);
+    Move move;
     
-    for (const auto& move : moves) {
-        if (isTimeUp()) break;
+    while (nextMove(move)) {
+        board.placeStone(move.first, move.second, US);
         
-        board.placeStone(move.first, move.second, currentPlayer);
-        
-        int score = -alphaBeta(board, depth - 1, -beta, -alpha, 
-                               maximizingPlayer, nextPlayer);
+        int score;
+        if constexpr (PV_NODE) {
+            if (searched == 0) {
+                score = -search<NodeType::PV, ROOT_COLOR, THEM>(board, depth - 1, -beta, -alpha, ply + 1);
+            } else {
+                score = -search<NodeType::NON_PV, ROOT_COLOR, THEM>(board, depth - 1, -alpha - 1, -alpha, ply + 1);
+                if (score > alpha && score < beta && !isStopped()) {
+                    score = -search<NodeType::PV, ROOT_COLOR, THEM>(board, depth - 1, -beta, -alpha, ply + 1);
+                }
+            }
+        } else {
+            score = -search<NodeType::NON_PV, ROOT_COLOR, THEM>(board, depth - 1, -beta, -alpha, ply + 1);
+        }
+        searched++;
         
-        // Undo move (need to implement in Board class)
+        // Undo move
         board.placeStone(move.first, move.second, Cell::EMPTY);
+        if (isStopped()) {
+            return 0;
+        }
         
-        maxScore = std::max(maxScore, score);
+        if (score > maxScore) {
+            maxScore = score;
+            bestMove = move;
+        }
         alpha = std::max(alpha, score);
         
         if (alpha >= beta) {
-            break; // Beta cutoff
+            TRACE_EVENT(CUTOFF, ply, depth, picker.getQuietCount());
+            if (pruningStats) {
+                int index = std::min(picker.getQuietCount(), PruningStats::MAX_INDEX - 1);
+                pruningStats->cutoffs[depth][index]++;
+            }
+            
+            // Beta cutoff: remember the move for sibling nodes and later turns
+            if (frame.killers[0] != move) {
+                frame.killers[1] = frame.killers[0];
+                frame.killers[0] = move;
+            }
+            
+            int& counter = history[COLOR_INDEX][move.second * N + move.first];
+            counter += depth * depth;
+            if (counter > HISTORY_MAX) {
+                for (auto& colorHistory : history) {
+                    for (auto& value : colorHistory) {
+                        value /= 2;
+                    }
+                }
+            }
+            break;
         }
     }
     
+    if (bestMove.first == -1) {
+        return evaluateLeaf<ROOT_COLOR, US>(board);
+    }
+    
+    Bound bound = (maxScore <= originalAlpha) ? Bound::UPPER :
+                  (maxScore >= beta) ? Bound::LOWER : Bound::EXACT;
+    if (pruningStats && probCut && bound == Bound::EXACT) {
+        double error = static_cast<double>(maxScore - reducedScore);
+        pruningStats->probCutSamples[depth]++;
+        pruningStats->probCutSum[depth] += error;
+        pruningStats->probCutSquares[depth] += error * error;
+    }
+    transpositionTable.store(key, depth, maxScore, bound, Board<N>::Symmetry::apply(bestMove, symmetry));
+    if constexpr (ROOT_NODE) {
+        rootMove = bestMove;
+    }
+    
     return maxScore;
 }
 
+// No win for either side and no open three against the side to move: the
+// only nodes where ProbCut trusts a reduced search
+template <int N>
+template <Cell US>
+bool AI<N>::isQuietNode(const Board<N>& board, const MoveList& moves) const {
+    for (int i = 0; i < moves.size(); i++) {
+        Move move = moves[i];
+        if ((board.getThreats(move.first, move.second, US) & THREAT_FIVE) ||
+            (board.getThreats(move.first, move.second, opponentOf(US)) &
+             (THREAT_FIVE | THREAT_STRAIGHT_FOUR))) {
+            return false;
+        }
+    }
+    return true;
+}
+
 // Advanced position evaluation
-int AI::evaluatePositionAdvanced(const Board& board, Cell maximizingPlayer) {
-    Cell opponent = getOpponentColor(maximizingPlayer);
-    
-    // Evaluate patterns for both players
-    int myScore = PatternDetector::evaluatePatterns(board, maximizingPlayer);
-    int opponentScore = PatternDetector::evaluatePatterns(board, opponent);
+template <int N>
+int AI<N>::evaluatePositionAdvanced(const Board<N>& board, Cell maximizingPlayer) {
+    return (maximizingPlayer == Cell::BLACK)
+        ? PatternDetector<N>::template evaluateFor<Cell::BLACK>(board)
+        : PatternDetector<N>::template evaluateFor<Cell::WHITE>(board);
+}
+
+// Leaf score from US's side with the selected evaluation, through the cache
+template <int N>
+template <Cell ROOT_COLOR, Cell US>
+int AI<N>::evaluateLeaf(const Board<N>& board) {
+    uint64_t key = EvalCache::key(board.getHash(), US == Cell::BLACK, ROOT_COLOR == Cell::BLACK);
+    int score;
+    if (evalCache.probe(key, score)) {
+        return score;
+    }
     
-    // Weight defense slightly higher
-    return myScore - (opponentScore * 1.1);
+    if (evaluation == Evaluation::NNUE && Nnue<N>::isAvailable()) {
+        score = Nnue<N>::evaluate(board, US);
+    } else {
+        score = PatternDetector<N>::template evaluateFor<ROOT_COLOR>(board);
+        score = (US == ROOT_COLOR) ? score : -score;
+    }
+    evalCache.store(key, score);
+    return score;
 }
 
 // Basic evaluation (fallback)
-int AI::evaluatePosition(const Board& board, Cell maximizingPlayer) {
+template <int N>
+int AI<N>::evaluatePosition(const Board<N>& board, Cell maximizingPlayer) {
     return evaluatePositionAdvanced(board, maximizingPlayer);
 }
 
 // Get relevant moves (reduce search space)
-std::vector<Move> AI::getRelevantMoves(const Board& board) {
-    std::vector<Move> relevantMoves;
+template <int N>
+void AI<N>::getRelevantMoves(const Board<N>& board, MoveList& moves) {
+    moves.clear();
     
-    // Only consider moves near existing stones
-    for (int y = 0; y < 20; y++) {
-        for (int x = 0; x < 20; x++) {
+    // Only consider moves near existing stones: inside their bounding box
+    // grown by 2 (every cell on an empty board)
+    BoardArea area = (board.getMoveCount() == 0) ? BoardArea{0, 0, N - 1, N - 1} : board.getStoneArea(2);
+    for (int y = area.minY; y <= area.maxY; y++) {
+        for (int x = area.minX; x <= area.maxX; x++) {
             if (board.getCell(x, y) == Cell::EMPTY) {
                 // Check if there's a stone within 2 squares
                 bool hasNeighbor = false;
@@ -195,7 +477,7 @@ std::vector<Move> AI::getRelevantMoves(const Board& board) {
                         int nx = x + dx;
                         int ny = y + dy;
                         
-                        if (nx >= 0 && nx < 20 && ny >= 0 && ny < 20) {
+                        if (nx >= 0 && nx < N && ny >= 0 && ny < N) {
                             if (board.getCell(nx, ny) != Cell::EMPTY) {
                                 hasNeighbor = true;
                                 break;
@@ -205,137 +487,206 @@ std::vector<Move> AI::getRelevantMoves(const Board& board) {
                 }
                 
                 if (hasNeighbor || board.getMoveCount() == 0) {
-                    relevantMoves.emplace_back(x, y);
+                    moves.add(Move(x, y));
                 }
             }
         }
     }
     
     // If board is empty, start in center
-    if (relevantMoves.empty()) {
-        relevantMoves.emplace_back(10, 10);
+    if (moves.empty()) {
+        moves.add(Move(Board<N>::CENTER, Board<N>::CENTER));
     }
-    
-    return relevantMoves;
 }
 
-// Advanced move ordering for better alpha-beta pruning
-std::vector<Move> AI::getOrderedMovesAdvanced(const Board& board, Cell myColor) {
-    auto moves = getRelevantMoves(board);
-    Cell opponent = getOpponentColor(myColor);
+// Advanced move ordering for better alpha-beta pruning (eager, used at the root)
+template <int N>
+bool AI<N>::getOrderedMovesAdvanced(const Board<N>& board, Cell myColor, MoveList& moves) {
+    getRelevantMoves(board, moves);
+    bool reduced = reduceSymmetricMoves(board, moves);
+    bool forced = MovePicker<N>::restrictToForced(board, myColor, moves);
     
     // Score each move
-    std::vector<std::pair<Move, int>> scoredMoves;
-    
-    for (const auto& move : moves) {
-        int score = 0;
-        
-        // Check if winning move
-        if (isWinningMove(board, move, myColor)) {
-            score += 1000000;
-        }
-        
-        // Check if blocks opponent win
-        if (isWinningMove(board, move, opponent)) {
-            score += 500000;
-        }
-        
-        // Check pattern strength
-        Board tempBoard = board;
-        tempBoard.placeStone(move.first, move.second, myColor);
-        
-        if (PatternDetector::hasOpenFour(tempBoard, move.first, move.second, myColor)) {
-            score += 100000;
-        }
-        if (PatternDetector::hasOpenThree(tempBoard, move.first, move.second, myColor)) {
-            score += 10000;
-        }
-        if (PatternDetector::hasFour(tempBoard, move.first, move.second, myColor)) {
-            score += 50000;
-        }
-        if (PatternDetector::hasThree(tempBoard, move.first, move.second, myColor)) {
-            score += 5000;
-        }
-        
-        // Check opponent patterns (defense)
-        tempBoard = board;
-        tempBoard.placeStone(move.first, move.second, opponent);
-        
-        if (PatternDetector::hasOpenFour(tempBoard, move.first, move.second, opponent)) {
-            score += 80000;
-        }
-        if (PatternDetector::hasOpenThree(tempBoard, move.first, move.second, opponent)) {
-            score += 8000;
-        }
-        
-        // Prefer center
-        int centerDist = std::abs(move.first - 10) + std::abs(move.second - 10);
-        score += (40 - centerDist) * 10;
-        
-        scoredMoves.emplace_back(move, score);
+    for (int i = 0; i < moves.size(); i++) {
+        moves.setScore(i, MovePicker<N>::scoreMove(board, moves[i], myColor));
     }
     
     // Sort by score (descending)
-    std::sort(scoredMoves.begin(), scoredMoves.end(),
-              [](const auto& a, const auto& b) { return a.second > b.second; });
+    moves.sortByScore();
     
-    // Extract moves
-    std::vector<Move> orderedMoves;
-    for (const auto& sm : scoredMoves) {
-        orderedMoves.push_back(sm.first);
+    // Root width: the best ROOT_MOVES, plus any forcing move below them
+    int kept = 0;
+    for (int i = 0; i < moves.size(); i++) {
+        if (i < ROOT_MOVES || MovePicker<N>::isForcing(board, moves[i], myColor)) {
+            moves.swap(kept++, i);
+        }
     }
-    
-    // Limit to top moves for deep searches
-    if (orderedMoves.size() > 20) {
-        orderedMoves.resize(20);
+    moves.truncate(kept);
+    return reduced || forced;
+}
+
+// Symmetric position (typically the opening): mirror images of a move lead
+// to the same game, keep the one with the lowest cell index of each set
+template <int N>
+bool AI<N>::reduceSymmetricMoves(const Board<N>& board, MoveList& moves) {
+    uint8_t symmetries = board.getSymmetries();
+    if (symmetries == 1) {
+        return false;
     }
-    
-    return orderedMoves;
+
+    int kept = 0;
+    for (int i = 0; i < moves.size(); i++) {
+        int cell = moves[i].second * N + moves[i].first;
+        bool representative = true;
+        for (int s = 1; s < Board<N>::Symmetry::COUNT && representative; s++) {
+            representative = !(symmetries & (1u << s)) || Board<N>::Symmetry::cells[s][cell] >= cell;
+        }
+        if (representative) {
+            moves.swap(kept++, i);
+        }
+    }
+    moves.truncate(kept);
+    return true;
 }
 
 // Simple move ordering (fallback)
-std::vector<Move> AI::getOrderedMoves(const Board& board, Cell myColor) {
-    return getOrderedMovesAdvanced(board, myColor);
+template <int N>
+void AI<N>::getOrderedMoves(const Board<N>& board, Cell myColor, MoveList& moves) {
+    getOrderedMovesAdvanced(board, myColor, moves);
 }
 
-int AI::getMoveScore(const Board& board, Move move, Cell myColor) {
+template <int N>
+int AI<N>::getMoveScore(const Board<N>& board, Move move, Cell myColor) {
     (void)board;
     (void)myColor;
     
     // Distance from center
-    int centerX = 10;
-    int centerY = 10;
+    int centerX = Board<N>::CENTER;
+    int centerY = Board<N>::CENTER;
     return -(std::abs(move.first - centerX) + std::abs(move.second - centerY));
 }
 
-bool AI::isWinningMove(const Board& board, Move move, Cell myColor) {
-    Board tempBoard = board;
-    tempBoard.placeStone(move.first, move.second, myColor);
-    return tempBoard.checkWin(move.first, move.second, myColor);
+template <int N>
+bool AI<N>::isWinningMove(const Board<N>& board, Move move, Cell myColor) {
+    return board.isValidMove(move.first, move.second) &&
+           board.checkWin(move.first, move.second, myColor);
 }
 
-bool AI::isThreatBlocking(const Board& board, Move move, Cell opponentColor) {
+template <int N>
+bool AI<N>::isThreatBlocking(const Board<N>& board, Move move, Cell opponentColor) {
     return isWinningMove(board, move, opponentColor);
 }
 
-void AI::resetSearchStats() {
-    nodesEvaluated = 0;
+// Stored deep entries go into the TT at the first search, once the root
+// color their scores must match is known
+template <int N>
+void AI<N>::loadExperience(const ExperienceStore& store) {
+    experience = &store;
+}
+
+// Root color of the TT scores: the first search of the game fixes it and
+// preloads the experience entries searched for it
+template <int N>
+void AI<N>::setRootColor(Cell myColor) {
+    if (rootColor == Cell::EMPTY) {
+        rootColor = myColor;
+        if (experience) {
+            std::vector<TTEntry> entries;
+            experience->getEntries(N, rootColor, entries);
+            for (const TTEntry& entry : entries) {
+                transpositionTable.preload(entry);
+            }
+            experience = nullptr;
+        }
+    } else if (rootColor != myColor) {
+        mixedRootColors = true;
+    }
+}
+
+// Deep entries this game searched (preloaded ones only if searched again)
+template <int N>
+void AI<N>::saveExperience(ExperienceStore& store) const {
+    if (rootColor == Cell::EMPTY || mixedRootColors) {
+        return;
+    }
+    std::vector<TTEntry> entries;
+    transpositionTable.collectSearched(EXPERIENCE_MIN_DEPTH, entries);
+    for (const TTEntry& entry : entries) {
+        store.record(N, rootColor, entry);
+    }
+}
+
+// Forget everything learned in the current game (START / RESTART)
+template <int N>
+void AI<N>::newGame() {
     transpositionTable.clear();
+    evalCache.clear();
+    for (auto& colorHistory : history) {
+        colorHistory.fill(0);
+    }
+    for (auto& frame : searchStack) {
+        frame.killers.fill(Move(-1, -1));
+    }
+    principalVariation.clear();
+    expectedHash = 0;
+    rootColor = Cell::EMPTY;
+    mixedRootColors = false;
+    experience = nullptr;
+    mcts.clear();
+    nodesEvaluated = 0;
 }
 
-bool AI::isTimeUp() const {
-    auto currentTime = std::chrono::steady_clock::now();
-    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
-        currentTime - startTime);
-    return elapsed.count() >= MAX_TIME_MS;
+// Per-move reset. Game-long state is kept; killers move up two plies
+// since the root is now two moves deeper.
+template <int N>
+void AI<N>::resetSearchStats() {
+    nodesEvaluated = 0;
+    evalCache.resetStats();
+    nextCheck = 0;
+    softStop = false;
+    stopSearch = false;
+    for (int ply = 0; ply < MAX_PLY; ply++) {
+        searchStack[ply].killers = (ply + 2 < MAX_PLY) ? searchStack[ply + 2].killers
+                                                       : std::array<Move, 2>{Move(-1, -1), Move(-1, -1)};
+    }
 }
 
-uint64_t AI::hashBoard(const Board& board) const {
-    uint64_t hash = 0;
-    for (int y = 0; y < 20; y++) {
-        for (int x = 0; x < 20; x++) {
-            hash ^= static_cast<uint64_t>(board.getCell(x, y)) << ((y * 20 + x) % 64);
+// Budget check, run every CHECK_INTERVAL nodes and between iterations.
+// The node limit is exact (deterministic); the clock is only read here.
+template <int N>
+void AI<N>::checkLimits() {
+    nextCheck = nodesEvaluated + CHECK_INTERVAL;
+    
+    if (limits.nodes > 0) {
+        if (nodesEvaluated >= limits.nodes) {
+            requestStop();
+            return;
         }
+        nextCheck = std::min(nextCheck, limits.nodes);
     }
-    return hash;
-}
\ No newline at end of file
+    
+    if (limits.timeMs > 0) {
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - startTime).count();
+        if (elapsed >= limits.timeMs) {
+            requestStop();
+        } else if (elapsed * 100 >= static_cast<int64_t>(limits.timeMs) * SOFT_TIME_PERCENT) {
+            softStop = true;
+        }
+    }
+}
+
+// Early positions share TT entries with their mirror images: the key is the
+// canonical hash and moves are stored in that image's coordinates
+template <int N>
+uint64_t AI<N>::hashBoard(const Board<N>& board, int& symmetry) const {
+    if (board.getMoveCount() <= CANONICAL_STONES) {
+        return board.getCanonicalHash(symmetry);
+    }
+    symmetry = 0;
+    return board.getHash();
+}
+
+// Supported sizes
+template class AI<15>;
+template class AI<20>;
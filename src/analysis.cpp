@@ -0,0 +1,166 @@
+#include "analysis.hpp"
+#include "utils.hpp"
+#include <algorithm>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+BatchAnalyzer::BatchAnalyzer(const EngineOptions& options, int jobs)
+    : options(options), jobs(jobs), inputDone(false), nextToWrite(0), output(nullptr) {
+    if (this->jobs <= 0) {
+        this->jobs = std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+void BatchAnalyzer::run(std::istream& input, std::ostream& out) {
+    output = &out;
+    inputDone = false;
+    nextToWrite = 0;
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < jobs; i++) {
+        workers.emplace_back(&BatchAnalyzer::worker, this);
+    }
+
+    // Stream the input, keeping only a few positions per worker in memory
+    const size_t maxQueued = static_cast<size_t>(jobs) * 4;
+    std::string line;
+    int lineNumber = 0;
+    long sequence = 0;
+
+    while (std::getline(input, line)) {
+        lineNumber++;
+        line = trimString(line);
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(queueMutex);
+        queueChanged.wait(lock, [&] { return queue.size() < maxQueued; });
+        queue.push_back({sequence++, lineNumber, line});
+        queueChanged.notify_all();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        inputDone = true;
+    }
+    queueChanged.notify_all();
+
+    for (auto& thread : workers) {
+        thread.join();
+    }
+}
+
+// One pool thread: its engine is reused for every position of the same size
+void BatchAnalyzer::worker() {
+    std::unique_ptr<Engine> engine;
+
+    while (true) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            queueChanged.wait(lock, [&] { return !queue.empty() || inputDone; });
+            if (queue.empty()) {
+                return;
+            }
+            task = std::move(queue.front());
+            queue.pop_front();
+        }
+        queueChanged.notify_all();
+
+        publish(task.sequence, analyze(task, engine));
+    }
+}
+
+// Set up one position from scratch and search it
+std::string BatchAnalyzer::analyze(const Task& task, std::unique_ptr<Engine>& engine) {
+    std::ostringstream result;
+    result << "position " << task.line << ": ";
+
+    std::istringstream stream(task.text);
+    std::vector<std::string> tokens;
+    std::string token;
+    while (stream >> token) {
+        tokens.push_back(token);
+    }
+
+    // Optional board size first
+    int boardSize = 20;
+    size_t first = 0;
+    if (!tokens.empty() && tokens[0].find(',') == std::string::npos) {
+        try {
+            boardSize = std::stoi(tokens[0]);
+        } catch (const std::exception&) {
+            boardSize = -1;
+        }
+        first = 1;
+    }
+    if (!isValidBoardSize(boardSize)) {
+        result << "error unsupported board size";
+        return result.str();
+    }
+
+    if (!engine || engine->getBoardSize() != boardSize) {
+        engine.reset(); // Old tables go before the new ones are allocated
+        engine = Engine::create(boardSize, options);
+    }
+    engine->newGame();
+
+    Cell toMove = Cell::BLACK;
+    for (size_t i = first; i < tokens.size(); i++) {
+        auto coords = splitString(tokens[i], ',');
+        int x = -1;
+        int y = -1;
+        try {
+            if (coords.size() == 2) {
+                x = std::stoi(coords[0]);
+                y = std::stoi(coords[1]);
+            }
+        } catch (const std::exception&) {
+            x = -1;
+        }
+        if (!isValidCoordinate(x, y, boardSize) || !engine->isValidMove(x, y)) {
+            result << "error invalid move " << tokens[i];
+            return result.str();
+        }
+        engine->placeStone(x, y, toMove);
+        toMove = (toMove == Cell::BLACK) ? Cell::WHITE : Cell::BLACK;
+    }
+
+    Move move = engine->findBestMove(toMove);
+    if (!engine->isValidMove(move.first, move.second)) {
+        move = engine->getFallbackMove();
+        if (move.first < 0) {
+            result << "error no valid moves available";
+            return result.str();
+        }
+    }
+
+    SearchInfo info;
+    engine->getSearchInfo(info);
+    result << "move " << move.first << "," << move.second
+           << " score " << info.score << " depth " << info.depth
+           << " nodes " << info.nodes << " pv";
+    for (const Move& pvMove : info.principalVariation) {
+        result << " " << pvMove.first << "," << pvMove.second;
+    }
+    return result.str();
+}
+
+// Store a result and write every result that is now in order
+void BatchAnalyzer::publish(long sequence, std::string text) {
+    std::lock_guard<std::mutex> lock(outputMutex);
+    pending.emplace(sequence, std::move(text));
+
+    bool wrote = false;
+    for (auto it = pending.find(nextToWrite); it != pending.end(); it = pending.find(nextToWrite)) {
+        *output << it->second << '\n';
+        pending.erase(it);
+        nextToWrite++;
+        wrote = true;
+    }
+    if (wrote) {
+        output->flush();
+    }
+}
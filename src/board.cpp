@@ -1,35 +1,244 @@
 #include "board.hpp"
+#include "nnue.hpp"
+#include <bit>
 #include <iostream>
 
-Board::Board() : moveCount(0) {
+template <int N>
+Board<N>::Board() : moveCount(0), hash(0) {
     clear();
 }
 
-void Board::clear() {
+template <int N>
+void Board<N>::clear() {
     for (auto& row : grid) {
         row.fill(Cell::EMPTY);
     }
+    for (auto& masks : lineMasks) {
+        masks.fill(0);
+    }
+    Nnue<N>::resetAccumulator(accumulator);
+    for (auto& colorThreats : lineThreats) {
+        colorThreats.fill(0); // Lone stones make nothing
+    }
+    stoneCounts.fill(0);
+    stoneBox = BoardArea{N, N, -1, -1};
     moveCount = 0;
+    hash = 0;
+    symmetricHashes.fill(0);
+}
+
+// Line classes by neighborhood. A class only depends on the 4 cells on each
+// side of the new stone: bits 0-3 / 4-7 of each byte are the cells before /
+// after it, low byte = own stones, high byte = empty cells (anything else is
+// blocked: opponent or off the board).
+namespace {
+
+// Completions (empty cells giving five) in the windows of 5 through the
+// center of a 9-cell neighborhood, bit 4 = the new stone
+constexpr int countCompletions(uint32_t own, uint32_t empty) {
+    uint32_t completions = 0;
+    for (int start = 0; start <= 4; start++) {
+        uint32_t missing = (0x1Fu << start) & ~own;
+        if (std::popcount(missing) == 1 && (missing & empty)) {
+            completions |= missing;
+        }
+    }
+    return std::popcount(completions);
+}
+
+constexpr uint8_t classifyLine(uint32_t own, uint32_t empty) {
+    for (int start = 0; start <= 4; start++) {
+        if (((own >> start) & 0x1F) == 0x1F) {
+            return THREAT_FIVE;
+        }
+    }
+
+    int completions = countCompletions(own, empty);
+    if (completions > 0) {
+        return completions >= 2 ? THREAT_STRAIGHT_FOUR : THREAT_FOUR;
+    }
+
+    // Threes: what one more stone on this line can make
+    uint8_t best = 0;
+    for (int k = 0; k < 9; k++) {
+        if (empty & (1u << k)) {
+            int next = countCompletions(own | (1u << k), empty & ~(1u << k));
+            if (next >= 2) {
+                return THREAT_OPEN_THREE;
+            }
+            if (next == 1) {
+                best = THREAT_THREE;
+            }
+        }
+    }
+    return best;
+}
+
+constexpr std::array<uint8_t, 1 << 16> LINE_CLASSES = [] {
+    std::array<uint8_t, 1 << 16> table{};
+    for (uint32_t own = 0; own < 256; own++) {
+        for (uint32_t empty = 0; empty < 256; empty++) {
+            if (own & empty) {
+                continue;
+            }
+            uint32_t own9 = (own & 0xF) | 0x10 | ((own >> 4) << 5);
+            uint32_t empty9 = (empty & 0xF) | ((empty >> 4) << 5);
+            table[own | (empty << 8)] = classifyLine(own9, empty9);
+        }
+    }
+    return table;
+}();
+
+// Neighborhood of lane bit `bit`, from lane masks shifted left by 4
+inline int neighborhood(uint64_t own, uint64_t empty, int bit) {
+    uint32_t o = static_cast<uint32_t>(own >> bit) & 0x1FF;
+    uint32_t e = static_cast<uint32_t>(empty >> bit) & 0x1FF;
+    return static_cast<int>((o & 0xF) | ((o >> 5) << 4) | (((e & 0xF) | ((e >> 5) << 4)) << 8));
+}
+
+// Lane of (x, y) for LINE_DIRECTIONS[d]
+template <int N>
+inline int laneOf(int d, int x, int y) {
+    using Lines = LineGeometry<N>;
+    return d == 0 ? Lines::row(x, y) : d == 1 ? Lines::column(x, y) :
+           d == 2 ? Lines::diagonal(x, y) : Lines::antiDiagonal(x, y);
+}
+
+} // namespace
+
+// Refresh the threat map around a changed cell: a class only depends on the
+// cells up to 4 away along its line
+template <int N>
+void Board<N>::updateThreats(int x, int y) {
+    for (int d = 0; d < 4; d++) {
+        int dx = LINE_DIRECTIONS[d][0];
+        int dy = LINE_DIRECTIONS[d][1];
+        int lane = laneOf<N>(d, x, y);
+        int bit = (d == 1) ? y : x;
+        uint32_t black = lineMasks[0][lane];
+        uint32_t white = lineMasks[1][lane];
+        uint64_t empty = static_cast<uint64_t>(Lines::validMasks[lane] & ~(black | white)) << 4;
+        uint64_t blackShifted = static_cast<uint64_t>(black) << 4;
+        uint64_t whiteShifted = static_cast<uint64_t>(white) << 4;
+        uint32_t keep = ~(0xffu << (8 * d));
+
+        for (int k = -4; k <= 4; k++) {
+            int cx = x + k * dx;
+            int cy = y + k * dy;
+            if (cx < 0 || cx >= BOARD_SIZE || cy < 0 || cy >= BOARD_SIZE) {
+                continue;
+            }
+            int cell = cy * BOARD_SIZE + cx;
+            uint32_t blackClass = LINE_CLASSES[neighborhood(blackShifted, empty, bit + k)];
+            uint32_t whiteClass = LINE_CLASSES[neighborhood(whiteShifted, empty, bit + k)];
+            lineThreats[0][cell] = (lineThreats[0][cell] & keep) | (blackClass << (8 * d));
+            lineThreats[1][cell] = (lineThreats[1][cell] & keep) | (whiteClass << (8 * d));
+        }
+    }
+}
+
+template <int N>
+uint8_t Board<N>::probeLineThreats(int x, int y, int direction, Cell stone, int bx, int by) const {
+    int lane = laneOf<N>(direction, x, y);
+    uint32_t blocked = 1u << ((direction == 1) ? by : bx);
+    uint32_t own = lineMasks[stone == Cell::BLACK ? 0 : 1][lane] & ~blocked;
+    uint32_t empty = Lines::validMasks[lane] & ~(lineMasks[0][lane] | lineMasks[1][lane] | blocked);
+    return LINE_CLASSES[neighborhood(static_cast<uint64_t>(own) << 4, static_cast<uint64_t>(empty) << 4,
+                                     (direction == 1) ? y : x)];
 }
 
-bool Board::isValidMove(int x, int y) const {
+// Incremental state (hash, line masks, accumulator, threats) for a stone being added
+template <int N>
+void Board<N>::indexStone(int x, int y, Cell stone) {
+    int color = (stone == Cell::BLACK) ? 0 : 1;
+    hash ^= Zobrist::keys[color][y * BOARD_SIZE + x];
+    for (int symmetry = 0; symmetry < Symmetry::COUNT; symmetry++) {
+        symmetricHashes[symmetry] ^= Zobrist::keys[color][Symmetry::cells[symmetry][y * BOARD_SIZE + x]];
+    }
+
+    auto& masks = lineMasks[color];
+    masks[Lines::row(x, y)] |= 1u << x;
+    masks[Lines::column(x, y)] |= 1u << y;
+    masks[Lines::diagonal(x, y)] |= 1u << x;
+    masks[Lines::antiDiagonal(x, y)] |= 1u << x;
+
+    int cell = y * BOARD_SIZE + x;
+    stoneSlots[cell] = static_cast<uint16_t>(stoneCounts[color]);
+    stones[color][stoneCounts[color]++] = static_cast<uint16_t>(cell);
+    stoneBox.minX = std::min(stoneBox.minX, x);
+    stoneBox.minY = std::min(stoneBox.minY, y);
+    stoneBox.maxX = std::max(stoneBox.maxX, x);
+    stoneBox.maxY = std::max(stoneBox.maxY, y);
+
+    Nnue<N>::addStone(accumulator, cell, color);
+    updateThreats(x, y);
+}
+
+// Same for the stone at (x, y) being removed (call before clearing grid)
+template <int N>
+void Board<N>::unindexStone(int x, int y) {
+    int color = (grid[y][x] == Cell::BLACK) ? 0 : 1;
+    hash ^= Zobrist::keys[color][y * BOARD_SIZE + x];
+    for (int symmetry = 0; symmetry < Symmetry::COUNT; symmetry++) {
+        symmetricHashes[symmetry] ^= Zobrist::keys[color][Symmetry::cells[symmetry][y * BOARD_SIZE + x]];
+    }
+    Nnue<N>::removeStone(accumulator, y * BOARD_SIZE + x, color);
+
+    int cell = y * BOARD_SIZE + x;
+    uint16_t last = stones[color][--stoneCounts[color]];
+    stones[color][stoneSlots[cell]] = last;
+    stoneSlots[last] = stoneSlots[cell];
+    if (x == stoneBox.minX || x == stoneBox.maxX || y == stoneBox.minY || y == stoneBox.maxY) {
+        recomputeStoneBox();
+    }
+
+    for (auto& masks : lineMasks) {
+        masks[Lines::row(x, y)] &= ~(1u << x);
+        masks[Lines::column(x, y)] &= ~(1u << y);
+        masks[Lines::diagonal(x, y)] &= ~(1u << x);
+        masks[Lines::antiDiagonal(x, y)] &= ~(1u << x);
+    }
+    updateThreats(x, y);
+}
+
+// Bounding box from the stone lists (the stone being removed is already out)
+template <int N>
+void Board<N>::recomputeStoneBox() {
+    stoneBox = BoardArea{N, N, -1, -1};
+    for (int color = 0; color < 2; color++) {
+        for (int i = 0; i < stoneCounts[color]; i++) {
+            int x = stones[color][i] % N;
+            int y = stones[color][i] / N;
+            stoneBox.minX = std::min(stoneBox.minX, x);
+            stoneBox.minY = std::min(stoneBox.minY, y);
+            stoneBox.maxX = std::max(stoneBox.maxX, x);
+            stoneBox.maxY = std::max(stoneBox.maxY, y);
+        }
+    }
+}
+
+template <int N>
+bool Board<N>::isValidMove(int x, int y) const {
     return (x >= 0 && x < BOARD_SIZE && y >= 0 && y < BOARD_SIZE &&
             getCell(x, y) == Cell::EMPTY);
 }
 
-Cell Board::getCell(int x, int y) const {
+template <int N>
+Cell Board<N>::getCell(int x, int y) const {
     if (x >= 0 && x < BOARD_SIZE && y >= 0 && y < BOARD_SIZE) {
         return grid[y][x];
     }
     return Cell::EMPTY;
 }
 
-bool Board::placeStone(int x, int y, Cell stone) {
+template <int N>
+bool Board<N>::placeStone(int x, int y, Cell stone) {
     if (stone == Cell::EMPTY) {
         // Allow placing empty (for undo)
         if (x >= 0 && x < BOARD_SIZE && y >= 0 && y < BOARD_SIZE) {
             if (grid[y][x] != Cell::EMPTY) {
                 moveCount--;
+                unindexStone(x, y);
             }
             grid[y][x] = Cell::EMPTY;
             return true;
@@ -41,13 +250,16 @@ bool Board::placeStone(int x, int y, Cell stone) {
         return false;
     }
     grid[y][x] = stone;
+    indexStone(x, y, stone);
     moveCount++;
     return true;
 }
 
-bool Board::removeStone(int x, int y) {
+template <int N>
+bool Board<N>::removeStone(int x, int y) {
     if (x >= 0 && x < BOARD_SIZE && y >= 0 && y < BOARD_SIZE) {
         if (grid[y][x] != Cell::EMPTY) {
+            unindexStone(x, y);
             grid[y][x] = Cell::EMPTY;
             moveCount--;
             return true;
@@ -56,34 +268,50 @@ bool Board::removeStone(int x, int y) {
     return false;
 }
 
-bool Board::checkWin(int x, int y, Cell stone) const {
-    if (stone == Cell::EMPTY) {
-        return false;
-    }
-
-    // Check all 4 directions
-    const int directions[4][2] = {
-        {1, 0},
-        {0, 1},
-        {1, 1},
-        {1, -1}
-    };
-
-    for (int i = 0; i < 4; i++) {
-        int dx = directions[i][0];
-        int dy = directions[i][1];
-
-        int count = countConsecutive(x, y, dx, dy, stone);
+// Five through (x, y) for stone: one threat map read
+template <int N>
+bool Board<N>::checkWin(int x, int y, Cell stone) const {
+    return stone != Cell::EMPTY && (getThreats(x, y, stone) & THREAT_FIVE);
+}
 
-        if (count >= 5) {
-            return true;
+// Smallest of the 8 symmetric hashes (ties go to the lowest symmetry)
+template <int N>
+uint64_t Board<N>::getCanonicalHash(int& symmetry) const {
+    symmetry = 0;
+    for (int s = 1; s < Symmetry::COUNT; s++) {
+        if (symmetricHashes[s] < symmetricHashes[symmetry]) {
+            symmetry = s;
         }
     }
+    return symmetricHashes[symmetry];
+}
 
-    return false;
+// Candidates from the hashes, each confirmed on the stones: the images of
+// all stones holding the same color is the whole board matching
+template <int N>
+uint8_t Board<N>::getSymmetries() const {
+    uint8_t symmetries = 1;
+    for (int s = 1; s < Symmetry::COUNT; s++) {
+        if (symmetricHashes[s] != hash) {
+            continue;
+        }
+        bool same = true;
+        for (int color = 0; color < 2 && same; color++) {
+            for (int i = 0; i < stoneCounts[color] && same; i++) {
+                int cell = stones[color][i];
+                int image = Symmetry::cells[s][cell];
+                same = grid[image / N][image % N] == grid[cell / N][cell % N];
+            }
+        }
+        if (same) {
+            symmetries |= static_cast<uint8_t>(1u << s);
+        }
+    }
+    return symmetries;
 }
 
-int Board::countConsecutive(int x, int y, int dx, int dy, Cell stone) const {
+template <int N>
+int Board<N>::countConsecutive(int x, int y, int dx, int dy, Cell stone) const {
     int count = 1;
 
     // Count in positive direction
@@ -109,7 +337,8 @@ int Board::countConsecutive(int x, int y, int dx, int dy, Cell stone) const {
     return count;
 }
 
-std::vector<Move> Board::getAvailableMoves() const {
+template <int N>
+std::vector<Move> Board<N>::getAvailableMoves() const {
     std::vector<Move> moves;
     for (int y = 0; y < BOARD_SIZE; ++y) {
         for (int x = 0; x < BOARD_SIZE; ++x) {
@@ -121,11 +350,13 @@ std::vector<Move> Board::getAvailableMoves() const {
     return moves;
 }
 
-bool Board::isBoardFull() const {
+template <int N>
+bool Board<N>::isBoardFull() const {
     return moveCount >= BOARD_SIZE * BOARD_SIZE;
 }
 
-void Board::printBoard() const {
+template <int N>
+void Board<N>::printBoard() const {
     std::cout << std::endl;
     for (int y = 0; y < BOARD_SIZE; ++y) {
         for (int x = 0; x < BOARD_SIZE; ++x) {
@@ -134,4 +365,8 @@ void Board::printBoard() const {
         std::cout << std::endl;
     }
     std::cout << std::endl;
-}
\ No newline at end of file
+}
+
+// Supported sizes
+template class Board<15>;
+template class Board<20>;
@@ -0,0 +1,612 @@
+#include "cluster.hpp"
+#include "utils.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+// Socket helpers: POSIX only, every call fails on Windows
+#ifndef _WIN32
+
+// A path (anything with a '/') is a Unix socket, otherwise host:port
+bool isUnixAddress(const std::string& address) {
+    return address.find('/') != std::string::npos;
+}
+
+bool splitHostPort(const std::string& address, std::string& host, std::string& port) {
+    size_t colon = address.rfind(':');
+    if (colon == std::string::npos || colon + 1 == address.size()) {
+        return false;
+    }
+    host = address.substr(0, colon);
+    port = address.substr(colon + 1);
+    return true;
+}
+
+bool makeUnixAddress(const std::string& path, sockaddr_un& addr) {
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(addr.sun_path)) {
+        return false;
+    }
+    std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+    return true;
+}
+
+void configureSocket(int fd) {
+    int on = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on)); // Fails harmlessly on Unix sockets
+#ifdef SO_NOSIGPIPE
+    setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+}
+
+int connectTo(const std::string& address) {
+    if (isUnixAddress(address)) {
+        sockaddr_un addr;
+        int fd = makeUnixAddress(address, addr) ? socket(AF_UNIX, SOCK_STREAM, 0) : -1;
+        if (fd >= 0 && connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+            close(fd);
+            fd = -1;
+        }
+        return fd;
+    }
+
+    std::string host;
+    std::string port;
+    addrinfo hints;
+    addrinfo* results = nullptr;
+    std::memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    if (!splitHostPort(address, host, port) ||
+        getaddrinfo(host.empty() ? "127.0.0.1" : host.c_str(), port.c_str(), &hints, &results) != 0) {
+        return -1;
+    }
+
+    int fd = -1;
+    for (addrinfo* entry = results; entry && fd < 0; entry = entry->ai_next) {
+        fd = socket(entry->ai_family, entry->ai_socktype, entry->ai_protocol);
+        if (fd >= 0 && connect(fd, entry->ai_addr, entry->ai_addrlen) != 0) {
+            close(fd);
+            fd = -1;
+        }
+    }
+    freeaddrinfo(results);
+    if (fd >= 0) {
+        configureSocket(fd);
+    }
+    return fd;
+}
+
+int listenOn(const std::string& address) {
+    int fd = -1;
+    if (isUnixAddress(address)) {
+        sockaddr_un addr;
+        if (!makeUnixAddress(address, addr)) {
+            return -1;
+        }
+        unlink(address.c_str()); // Left over by an earlier worker
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd >= 0 && bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+            close(fd);
+            fd = -1;
+        }
+    } else {
+        std::string host;
+        std::string port;
+        addrinfo hints;
+        addrinfo* results = nullptr;
+        std::memset(&hints, 0, sizeof(hints));
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+        hints.ai_flags = AI_PASSIVE;
+        if (!splitHostPort(address, host, port) ||
+            getaddrinfo((host.empty() || host == "*") ? nullptr : host.c_str(), port.c_str(),
+                        &hints, &results) != 0) {
+            return -1;
+        }
+        for (addrinfo* entry = results; entry && fd < 0; entry = entry->ai_next) {
+            fd = socket(entry->ai_family, entry->ai_socktype, entry->ai_protocol);
+            int on = 1;
+            if (fd >= 0) {
+                setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+            }
+            if (fd >= 0 && bind(fd, entry->ai_addr, entry->ai_addrlen) != 0) {
+                close(fd);
+                fd = -1;
+            }
+        }
+        freeaddrinfo(results);
+    }
+
+    if (fd >= 0 && listen(fd, 4) != 0) {
+        close(fd);
+        fd = -1;
+    }
+    return fd;
+}
+
+bool sendLine(int fd, const std::string& line) {
+    std::string data = line + "\n";
+    int flags = 0;
+#ifdef MSG_NOSIGNAL
+    flags = MSG_NOSIGNAL;
+#endif
+    for (size_t sent = 0; sent < data.size();) {
+        ssize_t count = send(fd, data.data() + sent, data.size() - sent, flags);
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count <= 0) {
+            return false;
+        }
+        sent += static_cast<size_t>(count);
+    }
+    return true;
+}
+
+// Append what is available (blocks until something is); false on EOF / error
+bool receive(int fd, std::string& input) {
+    char chunk[4096];
+    ssize_t count;
+    do {
+        count = recv(fd, chunk, sizeof(chunk), 0);
+    } while (count < 0 && errno == EINTR);
+    if (count <= 0) {
+        return false;
+    }
+    input.append(chunk, static_cast<size_t>(count));
+    return true;
+}
+
+// Indices of the sockets with data (or a closed peer), empty on timeout
+std::vector<size_t> waitReadable(const std::vector<int>& fds, int timeoutMs) {
+    std::vector<pollfd> polled;
+    for (int fd : fds) {
+        polled.push_back(pollfd{fd, POLLIN, 0});
+    }
+    std::vector<size_t> ready;
+    int count = poll(polled.data(), polled.size(), timeoutMs);
+    for (size_t i = 0; count > 0 && i < polled.size(); i++) {
+        if (polled[i].revents != 0) {
+            ready.push_back(i);
+        }
+    }
+    return ready;
+}
+
+void closeSocket(int fd) {
+    close(fd);
+}
+
+#else
+
+int connectTo(const std::string&) { return -1; }
+int listenOn(const std::string&) { return -1; }
+bool sendLine(int, const std::string&) { return false; }
+bool receive(int, std::string&) { return false; }
+std::vector<size_t> waitReadable(const std::vector<int>&, int) { return {}; }
+void closeSocket(int) {}
+
+#endif
+
+// Cut the first complete line off input
+bool takeLine(std::string& input, std::string& line) {
+    size_t end = input.find('\n');
+    if (end == std::string::npos) {
+        return false;
+    }
+    line = trimString(input.substr(0, end));
+    input.erase(0, end + 1);
+    return true;
+}
+
+bool parseMove(const std::string& text, Move& move) {
+    auto coords = splitString(text, ',');
+    try {
+        if (coords.size() >= 2) {
+            move = Move(std::stoi(coords[0]), std::stoi(coords[1]));
+            return true;
+        }
+    } catch (const std::exception&) {
+    }
+    return false;
+}
+
+char colorLetter(Cell color) {
+    return static_cast<char>(color);
+}
+
+// depth:x,y:score
+bool parseIteration(const std::string& text, IterationResult& iteration) {
+    auto fields = splitString(text, ':');
+    try {
+        if (fields.size() == 3 && parseMove(fields[1], iteration.move)) {
+            iteration.depth = std::stoi(fields[0]);
+            iteration.score = std::stoi(fields[2]);
+            return true;
+        }
+    } catch (const std::exception&) {
+    }
+    return false;
+}
+
+// One SEARCH request, answered with a RESULT or ERROR line
+std::string answerSearch(std::istringstream& request, const EngineOptions& options,
+                         std::unique_ptr<Engine>& engine) {
+    long id = 0;
+    int boardSize = 0;
+    std::string color;
+    SearchLimits limits;
+    request >> id >> boardSize >> color >> limits.depth >> limits.nodes >> limits.timeMs;
+
+    std::ostringstream error;
+    error << "ERROR " << id << " ";
+    if (!request || !isValidBoardSize(boardSize) || (color != "X" && color != "O")) {
+        return error.str() + "bad request";
+    }
+    if (!engine || engine->getBoardSize() != boardSize) {
+        engine.reset(); // Old tables go before the new ones are allocated
+        engine = Engine::create(boardSize, options);
+    }
+    engine->clearBoard();
+
+    std::vector<Move> roots;
+    bool stones = true;
+    std::string token;
+    while (request >> token) {
+        Move move;
+        if (token == ";") {
+            stones = false;
+        } else if (!parseMove(token, move) || !isValidCoordinate(move.first, move.second, boardSize)) {
+            return error.str() + "bad move " + token;
+        } else if (!stones) {
+            roots.push_back(move);
+        } else if (engine->isValidMove(move.first, move.second)) {
+            engine->placeStone(move.first, move.second, token.back() == 'X' ? Cell::BLACK : Cell::WHITE);
+        }
+    }
+    if (roots.empty()) {
+        return error.str() + "no root moves";
+    }
+
+    engine->setLimits(limits);
+    engine->setRootMoves(roots);
+    Move best = engine->findBestMove(color == "X" ? Cell::BLACK : Cell::WHITE);
+    engine->setRootMoves({});
+    if (best.first < 0) {
+        return error.str() + "no valid root move";
+    }
+
+    // The final result, then every completed iteration (one, the final
+    // result, when the move was not searched)
+    SearchInfo info;
+    engine->getSearchInfo(info);
+    if (info.iterations.empty()) {
+        info.iterations.push_back(IterationResult{info.depth, best, info.score});
+    }
+    std::ostringstream result;
+    result << "RESULT " << id << " " << best.first << "," << best.second << " "
+           << info.score << " " << info.depth << " " << info.nodes;
+    for (const IterationResult& iteration : info.iterations) {
+        result << " " << iteration.depth << ":" << iteration.move.first << "," << iteration.move.second
+               << ":" << iteration.score;
+    }
+    return result.str();
+}
+
+} // namespace
+
+ClusterEngine::ClusterEngine(std::unique_ptr<Engine> local, const std::vector<std::string>& addresses)
+    : local(std::move(local)), distributed(false), requestId(0) {
+    for (const std::string& address : addresses) {
+        workers.push_back(Worker{address, -1, ""});
+    }
+    connectWorkers();
+}
+
+ClusterEngine::~ClusterEngine() {
+    for (Worker& worker : workers) {
+        disconnect(worker);
+    }
+}
+
+// (Re)connect the workers that are down; failures go to stderr
+void ClusterEngine::connectWorkers() {
+    for (Worker& worker : workers) {
+        if (worker.socket >= 0) {
+            continue;
+        }
+        worker.socket = connectTo(worker.address);
+        worker.input.clear();
+        if (worker.socket < 0) {
+            std::cerr << "cluster: cannot connect to " << worker.address << std::endl;
+        }
+    }
+}
+
+void ClusterEngine::disconnect(Worker& worker) {
+    if (worker.socket >= 0) {
+        closeSocket(worker.socket);
+        worker.socket = -1;
+    }
+    worker.input.clear();
+}
+
+bool ClusterEngine::sendRequest(Worker& worker, const std::string& line) {
+    if (worker.socket >= 0 && sendLine(worker.socket, line)) {
+        return true;
+    }
+    std::cerr << "cluster: lost " << worker.address << std::endl;
+    disconnect(worker);
+    return false;
+}
+
+int ClusterEngine::getConnectedWorkers() const {
+    return static_cast<int>(std::count_if(workers.begin(), workers.end(),
+                                          [](const Worker& worker) { return worker.socket >= 0; }));
+}
+
+// New game here and on every worker; lost workers get another chance
+void ClusterEngine::newGame() {
+    local->newGame();
+    connectWorkers();
+    for (Worker& worker : workers) {
+        if (worker.socket >= 0) {
+            sendRequest(worker, "NEWGAME");
+        }
+    }
+}
+
+void ClusterEngine::setLimits(const SearchLimits& searchLimits) {
+    limits = searchLimits;
+    local->setLimits(searchLimits);
+}
+
+// Stones as x,y,X / x,y,O tokens
+std::string ClusterEngine::describeStones() const {
+    std::ostringstream stones;
+    for (Cell color : {Cell::BLACK, Cell::WHITE}) {
+        for (const Move& stone : local->getStones(color)) {
+            stones << " " << stone.first << "," << stone.second << "," << colorLetter(color);
+        }
+    }
+    return stones.str();
+}
+
+// Whole search on the local engine, within what is left of the turn
+Move ClusterEngine::searchLocally(Cell myColor, int elapsedMs) {
+    distributed = false;
+    SearchLimits rest = limits;
+    if (limits.timeMs > 0) {
+        rest.timeMs = std::max(1, limits.timeMs - elapsedMs);
+    }
+    local->setLimits(rest);
+    Move move = local->findBestMove(myColor);
+    local->setLimits(limits);
+    return move;
+}
+
+Move ClusterEngine::findBestMove(Cell myColor) {
+    auto start = std::chrono::steady_clock::now();
+    auto elapsedMs = [&] {
+        return static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start).count());
+    };
+
+    std::vector<Move> roots = local->getRootMoves(myColor);
+    std::vector<Worker*> ready;
+    for (Worker& worker : workers) {
+        if (worker.socket >= 0) {
+            ready.push_back(&worker);
+        }
+    }
+    if (roots.size() < 2 || ready.empty()) {
+        return searchLocally(myColor, 0);
+    }
+
+    // Deal the root moves out, best-ordered first
+    size_t shares = std::min(ready.size(), roots.size());
+    std::vector<std::vector<Move>> parts(shares);
+    for (size_t i = 0; i < roots.size(); i++) {
+        parts[i % shares].push_back(roots[i]);
+    }
+
+    // Workers get what is left of the turn after the root ordering done here
+    requestId++;
+    std::string stones = describeStones();
+    int workerTimeMs = (limits.timeMs > 0) ? std::max(1, limits.timeMs - NETWORK_MARGIN_MS - elapsedMs()) : 0;
+    std::vector<Worker*> pending;
+    for (size_t i = 0; i < shares; i++) {
+        std::ostringstream request;
+        request << "SEARCH " << requestId << " " << local->getBoardSize() << " " << colorLetter(myColor)
+                << " " << limits.depth << " " << limits.nodes << " " << workerTimeMs << stones << " ;";
+        for (const Move& move : parts[i]) {
+            request << " " << move.first << "," << move.second;
+        }
+        if (sendRequest(*ready[i], request.str())) {
+            pending.push_back(ready[i]);
+        }
+    }
+
+    // Gather until every worker answered or the shared deadline passed
+    std::vector<std::vector<IterationResult>> answers;
+    SearchInfo info;
+    while (!pending.empty()) {
+        int waitMs = -1;
+        if (limits.timeMs > 0) {
+            waitMs = limits.timeMs - COLLECT_MARGIN_MS - elapsedMs();
+            if (waitMs <= 0) {
+                break;
+            }
+        }
+
+        std::vector<int> sockets;
+        for (Worker* worker : pending) {
+            sockets.push_back(worker->socket);
+        }
+        std::vector<size_t> readable = waitReadable(sockets, waitMs);
+        if (readable.empty()) {
+            break;
+        }
+
+        std::vector<Worker*> answered;
+        for (size_t index : readable) {
+            Worker& worker = *pending[index];
+            if (!receive(worker.socket, worker.input)) {
+                std::cerr << "cluster: lost " << worker.address << std::endl;
+                disconnect(worker);
+                answered.push_back(&worker);
+                continue;
+            }
+
+            std::string line;
+            while (takeLine(worker.input, line)) {
+                std::istringstream reply(line);
+                std::string kind;
+                long id = 0;
+                reply >> kind >> id;
+                if (id != requestId) {
+                    continue; // Late answer to an earlier request
+                }
+                answered.push_back(&worker);
+
+                std::string text;
+                Move move;
+                int score = 0;
+                int depth = 0;
+                int64_t nodes = 0;
+                if (kind == "RESULT" && reply >> text >> score >> depth >> nodes && parseMove(text, move) &&
+                    local->isValidMove(move.first, move.second)) {
+                    info.nodes += nodes;
+                    std::vector<IterationResult> iterations;
+                    IterationResult iteration;
+                    while (reply >> text && parseIteration(text, iteration)) {
+                        if (local->isValidMove(iteration.move.first, iteration.move.second)) {
+                            iterations.push_back(iteration);
+                        }
+                    }
+                    if (iterations.empty()) {
+                        iterations.push_back(IterationResult{depth, move, score});
+                    }
+                    answers.push_back(iterations);
+                } else {
+                    std::cerr << "cluster: " << worker.address << ": " << line << std::endl;
+                }
+            }
+        }
+        for (Worker* worker : answered) {
+            pending.erase(std::remove(pending.begin(), pending.end(), worker), pending.end());
+        }
+    }
+
+    if (answers.empty()) {
+        return searchLocally(myColor, elapsedMs());
+    }
+
+    // Scores of different depths do not compare (and odd / even depths lean
+    // opposite ways): pick among the workers' results at the deepest depth
+    // every worker completed
+    int commonDepth = SearchLimits::MAX_DEPTH;
+    for (const auto& iterations : answers) {
+        commonDepth = std::min(commonDepth, iterations.back().depth);
+    }
+    Move best(-1, -1);
+    for (const auto& iterations : answers) {
+        const IterationResult* result = nullptr;
+        for (const IterationResult& iteration : iterations) {
+            if (iteration.depth <= commonDepth) {
+                result = &iteration;
+            }
+        }
+        if (result && (best.first < 0 || result->score > info.score)) {
+            best = result->move;
+            info.score = result->score;
+            info.depth = result->depth;
+        }
+    }
+    if (best.first < 0) {
+        return searchLocally(myColor, elapsedMs());
+    }
+    info.principalVariation.assign(1, best);
+    lastInfo = info;
+    distributed = true;
+    return best;
+}
+
+void ClusterEngine::getSearchInfo(SearchInfo& info) const {
+    if (distributed) {
+        info = lastInfo;
+    } else {
+        local->getSearchInfo(info);
+    }
+}
+
+bool ClusterWorker::serve(const std::string& address, const EngineOptions& options) {
+    int listener = listenOn(address);
+    if (listener < 0) {
+#ifdef _WIN32
+        std::cerr << "Cluster workers need POSIX sockets" << std::endl;
+#else
+        std::cerr << "Cannot listen on " << address << std::endl;
+#endif
+        return false;
+    }
+    std::cerr << "worker listening on " << address << std::endl;
+
+    // The engine, and its tables, outlive connections as long as the size does not change
+    std::unique_ptr<Engine> engine;
+    while (true) {
+#ifndef _WIN32
+        int connection = accept(listener, nullptr, nullptr);
+        if (connection < 0 && errno == EINTR) {
+            continue;
+        }
+        if (connection < 0) {
+            std::cerr << "Cannot accept on " << address << std::endl;
+            closeSocket(listener);
+            return false;
+        }
+        configureSocket(connection);
+#else
+        int connection = -1;
+#endif
+
+        std::string input;
+        std::string line;
+        bool open = true;
+        while (open) {
+            while (open && takeLine(input, line)) {
+                std::istringstream request(line);
+                std::string command;
+                request >> command;
+                if (command == "NEWGAME") {
+                    if (engine) {
+                        engine->newGame();
+                    }
+                } else if (command == "SEARCH") {
+                    open = sendLine(connection, answerSearch(request, options, engine));
+                } else if (!command.empty()) {
+                    open = sendLine(connection, "ERROR 0 unknown command " + command);
+                }
+            }
+            open = open && receive(connection, input);
+        }
+        closeSocket(connection);
+    }
+}
@@ -0,0 +1,110 @@
+#include "engine.hpp"
+#include "cluster.hpp"
+
+namespace {
+
+// Engine for one compile-time board size
+template <int N>
+class EngineImpl : public Engine {
+    private:
+        Board<N> board;
+        AI<N> ai;
+
+    public:
+        explicit EngineImpl(const EngineOptions& options) {
+            ai.setSearchMode(options.searchMode);
+            ai.setEvaluation(options.evaluation);
+            ai.setThreads(options.threads);
+            ai.setEvalCacheSize(options.evalCacheMb);
+            ai.setLimits(options.limits);
+        }
+
+        int getBoardSize() const override { return N; }
+
+        void newGame() override {
+            board.clear();
+            ai.newGame();
+        }
+
+        void clearBoard() override { board.clear(); }
+        bool isValidMove(int x, int y) const override { return board.isValidMove(x, y); }
+        void placeStone(int x, int y, Cell stone) override { board.placeStone(x, y, stone); }
+        int getMoveCount() const override { return board.getMoveCount(); }
+        bool checkWin(int x, int y, Cell stone) const override { return board.checkWin(x, y, stone); }
+
+        void setLimits(const SearchLimits& limits) override { ai.setLimits(limits); }
+        Move findBestMove(Cell myColor) override { return ai.findBestMove(board, myColor); }
+
+        // First empty cell next to the stones (the box around them grown by
+        // one has one unless it is the whole board), the center on an empty
+        // board, (-1, -1) when the board is full
+        Move getFallbackMove() const override {
+            BoardArea area = board.getStoneArea(1);
+            if (area.isEmpty()) {
+                return Move(Board<N>::CENTER, Board<N>::CENTER);
+            }
+            for (int y = area.minY; y <= area.maxY; y++) {
+                for (int x = area.minX; x <= area.maxX; x++) {
+                    if (board.isValidMove(x, y)) {
+                        return Move(x, y);
+                    }
+                }
+            }
+            return Move(-1, -1);
+        }
+
+        void getSearchInfo(SearchInfo& info) const override {
+            info.score = ai.getLastScore();
+            info.depth = ai.getLastDepth();
+            info.nodes = (ai.getSearchMode() == SearchMode::MCTS) ? ai.getPlayouts()
+                                                                  : ai.getNodesEvaluated();
+            info.principalVariation = ai.getPrincipalVariation();
+            info.iterations = ai.getIterations();
+        }
+
+        void loadExperience(const ExperienceStore& store) override { ai.loadExperience(store); }
+        void saveExperience(ExperienceStore& store) const override { ai.saveExperience(store); }
+
+        std::vector<Move> getStones(Cell stone) const override {
+            std::vector<Move> stones;
+            for (int cell : board.getStones(stone)) {
+                stones.emplace_back(cell % N, cell / N);
+            }
+            return stones;
+        }
+
+        std::vector<Move> getRootMoves(Cell myColor) override {
+            MoveList moves;
+            std::vector<Move> result;
+            if (ai.getRootMoves(board, myColor, moves)) {
+                for (int i = 0; i < moves.size(); i++) {
+                    result.push_back(moves[i]);
+                }
+            }
+            return result;
+        }
+
+        void setRootMoves(const std::vector<Move>& moves) override { ai.setRootMoves(moves); }
+};
+
+} // namespace
+
+std::unique_ptr<Engine> Engine::create(int boardSize, const EngineOptions& options) {
+    std::unique_ptr<Engine> engine;
+    switch (boardSize) {
+        case 15:
+            engine = std::make_unique<EngineImpl<15>>(options);
+            break;
+        case 20:
+            engine = std::make_unique<EngineImpl<20>>(options);
+            break;
+        default:
+            return nullptr;
+    }
+
+    // With workers, the local engine keeps the position and splits the searches
+    if (!options.clusterWorkers.empty()) {
+        return std::make_unique<ClusterEngine>(std::move(engine), options.clusterWorkers);
+    }
+    return engine;
+}
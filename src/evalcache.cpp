@@ -0,0 +1,23 @@
+#include "evalcache.hpp"
+#include <algorithm>
+
+EvalCache::EvalCache() : mask(0), hits(0), misses(0) {
+    resize(DEFAULT_SIZE_MB);
+}
+
+void EvalCache::resize(int megabytes) {
+    size_t bytes = static_cast<size_t>(std::clamp(megabytes, 0, MAX_SIZE_MB)) * 1024 * 1024;
+    size_t count = (bytes >= sizeof(Entry)) ? 1 : 0;
+    while (count > 0 && count * 2 * sizeof(Entry) <= bytes) {
+        count *= 2;
+    }
+
+    entries.assign(count, Entry{0, 0});
+    mask = (count > 0) ? count - 1 : 0;
+    resetStats();
+}
+
+void EvalCache::clear() {
+    std::fill(entries.begin(), entries.end(), Entry{0, 0});
+    resetStats();
+}
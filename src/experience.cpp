@@ -0,0 +1,197 @@
+#include "experience.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace {
+
+const char FILE_MAGIC[4] = {'G', 'M', 'K', 'X'};
+const uint16_t FILE_VERSION = 2; // 1 had no root color
+const size_t FILE_HEADER_SIZE = 16;
+
+struct FileHeader {
+    char magic[4];
+    uint16_t version;
+    uint16_t entrySize;
+    uint32_t session;
+    uint32_t count;
+};
+
+static_assert(sizeof(FileHeader) == FILE_HEADER_SIZE, "header is written as is");
+
+// Read the whole file (the entries are merged in memory, so they are copied anyway)
+bool readFile(const std::string& path, std::vector<uint8_t>& contents, bool& missing) {
+    std::ifstream file(path, std::ios::binary);
+    missing = !file;
+    if (!file) {
+        return false;
+    }
+    contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return !file.bad();
+}
+
+} // namespace
+
+ExperienceStore::ExperienceStore() : maxEntries(DEFAULT_MAX_ENTRIES), session(1), dirty(false) {
+    static_assert(getEntryLimit(DEFAULT_MAX_ENTRIES) * sizeof(ExperienceEntry) +
+                  getIndexSize(DEFAULT_MAX_ENTRIES) * sizeof(uint32_t) <= static_cast<size_t>(MEMORY_MB) << 20,
+                  "MEMORY_MB bounds the default store");
+}
+
+size_t ExperienceStore::findSlot(uint64_t key, uint8_t rootColor) const {
+    size_t mask = index.size() - 1;
+    size_t slot = (key ^ (rootColor == ROOT_WHITE ? 0x9e3779b97f4a7c15ULL : 0)) & mask;
+    while (index[slot] != 0) {
+        const ExperienceEntry& entry = entries[index[slot] - 1];
+        if (entry.key == key && entry.rootColor == rootColor) {
+            break;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+void ExperienceStore::rebuildIndex() {
+    std::fill(index.begin(), index.end(), 0);
+    for (size_t i = 0; i < entries.size(); i++) {
+        index[findSlot(entries[i].key, entries[i].rootColor)] = static_cast<uint32_t>(i + 1);
+    }
+}
+
+// Least recently searched first out, shallower first among equals
+void ExperienceStore::evict() {
+    if (entries.size() <= maxEntries) {
+        return;
+    }
+    auto newer = [](const ExperienceEntry& a, const ExperienceEntry& b) {
+        return a.lastUsed != b.lastUsed ? a.lastUsed > b.lastUsed : a.depth > b.depth;
+    };
+    std::nth_element(entries.begin(), entries.begin() + maxEntries, entries.end(), newer);
+    entries.resize(maxEntries);
+    rebuildIndex();
+}
+
+bool ExperienceStore::open(const std::string& filePath, size_t limit) {
+    path = filePath;
+    maxEntries = std::max<size_t>(limit, 1);
+    session = 1;
+    entries.clear();
+    entries.reserve(getEntryLimit(maxEntries));
+    index.assign(getIndexSize(maxEntries), 0);
+    dirty = false;
+
+    std::vector<uint8_t> contents;
+    bool missing = false;
+    if (!readFile(path, contents, missing)) {
+        if (!missing) {
+            path.clear();
+        }
+        return missing; // Created by the first flush
+    }
+    if (contents.empty()) {
+        return true;
+    }
+
+    FileHeader header;
+    if (contents.size() < FILE_HEADER_SIZE) {
+        path.clear();
+        return false;
+    }
+    std::memcpy(&header, contents.data(), FILE_HEADER_SIZE);
+    if (std::memcmp(header.magic, FILE_MAGIC, 4) != 0 || header.version > FILE_VERSION ||
+        header.entrySize != sizeof(ExperienceEntry)) {
+        path.clear();
+        return false;
+    }
+    if (header.version < FILE_VERSION) {
+        return true; // Scores of unknown color: start over, the next flush replaces the file
+    }
+
+    // A torn write loses the incomplete tail only
+    size_t available = (contents.size() - FILE_HEADER_SIZE) / sizeof(ExperienceEntry);
+    size_t count = std::min({static_cast<size_t>(header.count), available, getEntryLimit(maxEntries)});
+    entries.resize(count);
+    std::memcpy(entries.data(), contents.data() + FILE_HEADER_SIZE, count * sizeof(ExperienceEntry));
+    rebuildIndex();
+    evict();
+    session = header.session + 1;
+    return true;
+}
+
+void ExperienceStore::getEntries(int boardSize, Cell rootColor, std::vector<TTEntry>& out) const {
+    uint8_t color = (rootColor == Cell::BLACK) ? ROOT_BLACK : ROOT_WHITE;
+    for (const ExperienceEntry& entry : entries) {
+        if (entry.boardSize == boardSize && entry.rootColor == color) {
+            out.push_back(TTEntry{entry.key, entry.score, entry.move, entry.depth, entry.bound});
+        }
+    }
+}
+
+void ExperienceStore::record(int boardSize, Cell rootColor, const TTEntry& entry) {
+    ExperienceEntry stored{};
+    stored.key = entry.key;
+    stored.score = entry.score;
+    stored.move = entry.move;
+    stored.depth = entry.depth;
+    stored.bound = static_cast<uint8_t>(TranspositionTable::getBound(entry));
+    stored.boardSize = static_cast<uint8_t>(boardSize);
+    stored.rootColor = (rootColor == Cell::BLACK) ? ROOT_BLACK : ROOT_WHITE;
+    stored.lastUsed = session;
+
+    size_t slot = findSlot(stored.key, stored.rootColor);
+    if (index[slot] == 0) {
+        entries.push_back(stored);
+        index[slot] = static_cast<uint32_t>(entries.size());
+        if (entries.size() >= getEntryLimit(maxEntries)) {
+            evict();
+        }
+    } else {
+        ExperienceEntry& existing = entries[index[slot] - 1];
+        if (existing.boardSize != stored.boardSize || stored.depth >= existing.depth) {
+            existing = stored;
+        } else {
+            existing.lastUsed = session;
+        }
+    }
+    dirty = true;
+}
+
+bool ExperienceStore::flush() {
+    if (!isOpen() || !dirty) {
+        return true;
+    }
+
+    evict();
+
+    FileHeader header;
+    std::memcpy(header.magic, FILE_MAGIC, 4);
+    header.version = FILE_VERSION;
+    header.entrySize = sizeof(ExperienceEntry);
+    header.session = session;
+    header.count = static_cast<uint32_t>(entries.size());
+
+    // Complete file under a temporary name, then replace the old one
+    std::string temporary = path + ".tmp";
+    std::FILE* file = std::fopen(temporary.c_str(), "wb");
+    if (!file) {
+        return false;
+    }
+    bool written = std::fwrite(&header, 1, sizeof(header), file) == sizeof(header) &&
+                   std::fwrite(entries.data(), sizeof(ExperienceEntry), entries.size(), file) == entries.size();
+    written = (std::fclose(file) == 0) && written;
+    if (!written) {
+        std::remove(temporary.c_str());
+        return false;
+    }
+#ifdef _WIN32
+    std::remove(path.c_str()); // rename does not replace there
+#endif
+    if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+        std::remove(temporary.c_str());
+        return false;
+    }
+    dirty = false;
+    return true;
+}
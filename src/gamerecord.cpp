@@ -0,0 +1,301 @@
+#include "gamerecord.hpp"
+#include <algorithm>
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+const char FILE_MAGIC[4] = {'G', 'M', 'K', 'R'};
+const uint16_t FILE_VERSION = 1;
+const size_t FILE_HEADER_SIZE = 8;
+const size_t RECORD_HEADER_SIZE = 16;
+const int MOVE_BITS = 9;
+const int MAX_RECORD_BOARD_SIZE = 22; // 22 * 22 cells still fit in 9 bits
+
+// Little-endian helpers
+void put16(std::vector<uint8_t>& out, uint16_t value) {
+    out.push_back(static_cast<uint8_t>(value));
+    out.push_back(static_cast<uint8_t>(value >> 8));
+}
+
+void put32(std::vector<uint8_t>& out, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+uint16_t get16(const uint8_t* p) {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+uint32_t get32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+size_t packedMovesSize(int moveCount) {
+    return (static_cast<size_t>(moveCount) * MOVE_BITS + 7) / 8;
+}
+
+} // namespace
+
+void GameRecord::clear() {
+    result = GameResult::UNKNOWN;
+    engineColor = Cell::EMPTY;
+    startTime = 0;
+    moves.clear();
+}
+
+// ---------------------------------------------------------------- writer
+
+GameRecordWriter::GameRecordWriter() : file(nullptr) {
+}
+
+GameRecordWriter::~GameRecordWriter() {
+    close();
+}
+
+bool GameRecordWriter::open(const std::string& path) {
+    close();
+
+    file = std::fopen(path.c_str(), "ab");
+    if (!file) {
+        return false;
+    }
+    buffer.resize(BUFFER_SIZE);
+    std::setvbuf(file, buffer.data(), _IOFBF, buffer.size());
+
+    // New file: write the file header first
+    std::fseek(file, 0, SEEK_END);
+    if (std::ftell(file) == 0) {
+        std::vector<uint8_t> header(FILE_MAGIC, FILE_MAGIC + 4);
+        put16(header, FILE_VERSION);
+        put16(header, static_cast<uint16_t>(RECORD_HEADER_SIZE));
+        std::fwrite(header.data(), 1, header.size(), file);
+    }
+    return true;
+}
+
+void GameRecordWriter::close() {
+    if (file) {
+        std::fclose(file);
+        file = nullptr;
+    }
+}
+
+void GameRecordWriter::flush() {
+    if (file) {
+        std::fflush(file);
+    }
+}
+
+// Serialize the game and hand it to stdio in one write
+bool GameRecordWriter::append(const GameRecord& game) {
+    if (!file || game.boardSize > MAX_RECORD_BOARD_SIZE || game.moves.size() > 0xffff) {
+        return false;
+    }
+
+    int moveCount = static_cast<int>(game.moves.size());
+    bytes.clear();
+    bytes.reserve(GameRecordReader::encodedSize(moveCount));
+
+    put32(bytes, GameRecordReader::encodedSize(moveCount));
+    bytes.push_back(static_cast<uint8_t>(game.boardSize));
+    bytes.push_back(static_cast<uint8_t>(game.result));
+    bytes.push_back(game.engineColor == Cell::BLACK ? 1 : game.engineColor == Cell::WHITE ? 2 : 0);
+    bytes.push_back(0);
+    put16(bytes, static_cast<uint16_t>(moveCount));
+    put16(bytes, 0);
+    put32(bytes, game.startTime);
+
+    // Moves, 9 bits each
+    size_t movesStart = bytes.size();
+    bytes.resize(movesStart + packedMovesSize(moveCount), 0);
+    for (int i = 0; i < moveCount; i++) {
+        const Move& move = game.moves[i].move;
+        uint32_t code = static_cast<uint32_t>(move.second * game.boardSize + move.first);
+        size_t bit = static_cast<size_t>(i) * MOVE_BITS;
+        for (int b = 0; b < MOVE_BITS; b++, bit++) {
+            if (code & (1u << b)) {
+                bytes[movesStart + bit / 8] |= static_cast<uint8_t>(1u << (bit % 8));
+            }
+        }
+    }
+
+    for (const auto& entry : game.moves) {
+        bytes.push_back(static_cast<uint8_t>(std::clamp(entry.depth, 0, 255)));
+    }
+    for (const auto& entry : game.moves) {
+        put32(bytes, static_cast<uint32_t>(entry.score));
+    }
+    for (const auto& entry : game.moves) {
+        put16(bytes, static_cast<uint16_t>(std::clamp(entry.timeMs, 0, 0xffff)));
+    }
+
+    return std::fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+}
+
+// ---------------------------------------------------------------- records
+
+uint32_t GameRecordView::getRecordSize() const {
+    return get32(data);
+}
+
+Cell GameRecordView::getEngineColor() const {
+    return data[6] == 1 ? Cell::BLACK : data[6] == 2 ? Cell::WHITE : Cell::EMPTY;
+}
+
+int GameRecordView::getMoveCount() const {
+    return get16(data + 8);
+}
+
+uint32_t GameRecordView::getStartTime() const {
+    return get32(data + 12);
+}
+
+Move GameRecordView::getMove(int index) const {
+    const uint8_t* moves = data + RECORD_HEADER_SIZE;
+    size_t bit = static_cast<size_t>(index) * MOVE_BITS;
+    // The 9 bits span at most two bytes
+    uint32_t word = moves[bit / 8] | (static_cast<uint32_t>(moves[bit / 8 + 1]) << 8);
+    int code = static_cast<int>((word >> (bit % 8)) & ((1u << MOVE_BITS) - 1));
+    return Move(code % getBoardSize(), code / getBoardSize());
+}
+
+int GameRecordView::getDepth(int index) const {
+    const uint8_t* depths = data + RECORD_HEADER_SIZE + packedMovesSize(getMoveCount());
+    return depths[index];
+}
+
+int GameRecordView::getScore(int index) const {
+    int moveCount = getMoveCount();
+    const uint8_t* scores = data + RECORD_HEADER_SIZE + packedMovesSize(moveCount) + moveCount;
+    return static_cast<int32_t>(get32(scores + 4 * index));
+}
+
+int GameRecordView::getTimeMs(int index) const {
+    int moveCount = getMoveCount();
+    const uint8_t* times = data + RECORD_HEADER_SIZE + packedMovesSize(moveCount) + 5 * moveCount;
+    return get16(times + 2 * index);
+}
+
+// ---------------------------------------------------------------- reader
+
+GameRecordReader::GameRecordReader()
+    : data(nullptr), size(0), offset(FILE_HEADER_SIZE)
+#ifndef _WIN32
+      , mapping(nullptr)
+#endif
+{
+}
+
+GameRecordReader::~GameRecordReader() {
+    close();
+}
+
+uint32_t GameRecordReader::encodedSize(int moveCount) {
+    return static_cast<uint32_t>(RECORD_HEADER_SIZE + packedMovesSize(moveCount) + 7 * moveCount);
+}
+
+bool GameRecordReader::open(const std::string& path) {
+    close();
+
+#ifndef _WIN32
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size < static_cast<off_t>(FILE_HEADER_SIZE)) {
+        ::close(fd);
+        return false;
+    }
+    size = static_cast<size_t>(info.st_size);
+    mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        mapping = nullptr;
+        size = 0;
+        return false;
+    }
+    madvise(mapping, size, MADV_SEQUENTIAL);
+    data = static_cast<const uint8_t*>(mapping);
+#else
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) {
+        return false;
+    }
+    std::fseek(file, 0, SEEK_END);
+    long length = std::ftell(file);
+    std::fseek(file, 0, SEEK_SET);
+    fallback.resize(length > 0 ? static_cast<size_t>(length) : 0);
+    size_t read = std::fread(fallback.data(), 1, fallback.size(), file);
+    std::fclose(file);
+    data = fallback.data();
+    size = read;
+#endif
+
+    if (size < FILE_HEADER_SIZE || std::memcmp(data, FILE_MAGIC, 4) != 0 ||
+        get16(data + 4) != FILE_VERSION) {
+        close();
+        return false;
+    }
+    rewind();
+    return true;
+}
+
+void GameRecordReader::close() {
+#ifndef _WIN32
+    if (mapping) {
+        munmap(mapping, size);
+        mapping = nullptr;
+    }
+#endif
+    fallback.clear();
+    data = nullptr;
+    size = 0;
+    offset = FILE_HEADER_SIZE;
+}
+
+void GameRecordReader::rewind() {
+    offset = FILE_HEADER_SIZE;
+}
+
+// Header consistent and the whole record inside the file (a torn write is not)
+bool GameRecordReader::isCompleteRecord(size_t position) const {
+    if (!data || position + RECORD_HEADER_SIZE > size) {
+        return false;
+    }
+
+    GameRecordView record(data + position);
+    uint32_t recordSize = record.getRecordSize();
+    return recordSize == encodedSize(record.getMoveCount()) && recordSize <= size - position &&
+           record.getBoardSize() >= 5 && record.getBoardSize() <= MAX_RECORD_BOARD_SIZE;
+}
+
+bool GameRecordReader::next(GameRecordView& record) {
+    if (!isCompleteRecord(offset)) {
+        return false;
+    }
+
+    record = GameRecordView(data + offset);
+    offset += record.getRecordSize();
+    return true;
+}
+
+std::vector<size_t> GameRecordReader::buildIndex() const {
+    std::vector<size_t> index;
+    size_t position = FILE_HEADER_SIZE;
+
+    while (isCompleteRecord(position)) {
+        index.push_back(position);
+        position += GameRecordView(data + position).getRecordSize();
+    }
+    return index;
+}
@@ -0,0 +1,206 @@
+#include "gomokuengine.h"
+#include <memory>
+#include <string>
+#include <vector>
+#include "engine.hpp"
+
+// Handle behind the C interface: the C++ Engine plus what is needed to
+// rebuild it when an option changes
+struct gomoku_engine {
+    int boardSize;
+    EngineOptions options;
+    std::unique_ptr<Engine> engine;
+    std::vector<Move> moves; // Current position, in move order
+    SearchInfo info;         // Last search
+};
+
+namespace {
+
+Cell sideToMove(size_t moveCount) {
+    return (moveCount % 2 == 0) ? Cell::BLACK : Cell::WHITE;
+}
+
+// Place moves on an empty board, false (board emptied) on the first bad one
+bool playMoves(gomoku_engine* handle, const std::vector<Move>& moves) {
+    handle->engine->clearBoard();
+    for (size_t i = 0; i < moves.size(); i++) {
+        const Move& move = moves[i];
+        if (!handle->engine->isValidMove(move.first, move.second)) {
+            handle->engine->clearBoard();
+            return false;
+        }
+        handle->engine->placeStone(move.first, move.second, sideToMove(i));
+    }
+    return true;
+}
+
+} // namespace
+
+// Nothing may throw across the C interface: every entry point catches
+// everything (allocation failures included) and returns an error instead.
+extern "C" {
+
+gomoku_engine* gomoku_engine_create(int boardSize) {
+    try {
+        EngineOptions options;
+        std::unique_ptr<Engine> engine = Engine::create(boardSize, options);
+        if (!engine) {
+            return nullptr;
+        }
+        return new gomoku_engine{boardSize, options, std::move(engine), {}, {}};
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void gomoku_engine_destroy(gomoku_engine* engine) {
+    try {
+        delete engine;
+    } catch (...) {
+    }
+}
+
+int gomoku_engine_set_option(gomoku_engine* engine, const char* name, const char* value) {
+    if (!engine || !name || !value) {
+        return GOMOKU_ERROR_ARGUMENT;
+    }
+
+    try {
+        std::string key = name;
+        std::string text = value;
+        EngineOptions options = engine->options;
+        if (key == "search" && (text == "alphabeta" || text == "mcts")) {
+            options.searchMode = (text == "mcts") ? SearchMode::MCTS : SearchMode::ALPHA_BETA;
+        } else if (key == "eval" && (text == "patterns" || text == "nnue")) {
+            options.evaluation = (text == "nnue") ? Evaluation::NNUE : Evaluation::PATTERNS;
+        } else if (key == "threads") {
+            try {
+                options.threads = std::stoi(text);
+            } catch (const std::exception&) {
+                return GOMOKU_ERROR_OPTION;
+            }
+            if (options.threads < 1) {
+                return GOMOKU_ERROR_OPTION;
+            }
+        } else if (key == "eval_cache") {
+            try {
+                options.evalCacheMb = std::stoi(text);
+            } catch (const std::exception&) {
+                return GOMOKU_ERROR_OPTION;
+            }
+            if (options.evalCacheMb < 0 || options.evalCacheMb > EvalCache::MAX_SIZE_MB) {
+                return GOMOKU_ERROR_OPTION;
+            }
+        } else {
+            return GOMOKU_ERROR_OPTION;
+        }
+
+        // Options are applied when an Engine is created (the old one stays
+        // if that fails)
+        std::unique_ptr<Engine> created = Engine::create(engine->boardSize, options);
+        if (!created) {
+            return GOMOKU_ERROR_INTERNAL;
+        }
+        engine->options = options;
+        engine->engine = std::move(created);
+        playMoves(engine, engine->moves);
+        return GOMOKU_OK;
+    } catch (...) {
+        return GOMOKU_ERROR_INTERNAL;
+    }
+}
+
+int gomoku_engine_new_game(gomoku_engine* engine) {
+    if (!engine) {
+        return GOMOKU_ERROR_ARGUMENT;
+    }
+    try {
+        engine->engine->newGame();
+        engine->moves.clear();
+        engine->info = SearchInfo();
+        return GOMOKU_OK;
+    } catch (...) {
+        return GOMOKU_ERROR_INTERNAL;
+    }
+}
+
+int gomoku_engine_set_position(gomoku_engine* engine, const gomoku_move* moves, int count) {
+    if (!engine || count < 0 || (count > 0 && !moves)) {
+        return GOMOKU_ERROR_ARGUMENT;
+    }
+
+    try {
+        engine->moves.clear();
+        for (int i = 0; i < count; i++) {
+            engine->moves.push_back(Move(moves[i].x, moves[i].y));
+        }
+        if (!playMoves(engine, engine->moves)) {
+            engine->moves.clear();
+            return GOMOKU_ERROR_MOVE;
+        }
+        return GOMOKU_OK;
+    } catch (...) {
+        engine->moves.clear();
+        engine->engine->clearBoard();
+        return GOMOKU_ERROR_INTERNAL;
+    }
+}
+
+int gomoku_engine_search(gomoku_engine* engine, const gomoku_limits* limits, gomoku_move* best) {
+    if (!engine || !best) {
+        return GOMOKU_ERROR_ARGUMENT;
+    }
+
+    try {
+        SearchLimits searchLimits = engine->options.limits;
+        if (limits && (limits->depth || limits->nodes || limits->time_ms)) {
+            searchLimits.depth = limits->depth;
+            searchLimits.nodes = limits->nodes;
+            searchLimits.timeMs = limits->time_ms;
+        }
+        engine->engine->setLimits(searchLimits);
+
+        Move move = engine->engine->findBestMove(sideToMove(engine->moves.size()));
+        if (!engine->engine->isValidMove(move.first, move.second)) {
+            move = engine->engine->getFallbackMove();
+            if (move.first < 0) {
+                return GOMOKU_ERROR_NO_MOVE;
+            }
+        }
+        engine->engine->getSearchInfo(engine->info);
+
+        best->x = move.first;
+        best->y = move.second;
+        return GOMOKU_OK;
+    } catch (...) {
+        engine->info = SearchInfo();
+        return GOMOKU_ERROR_INTERNAL;
+    }
+}
+
+// Plain reads: nothing to catch
+int gomoku_engine_get_score(const gomoku_engine* engine) {
+    return engine ? engine->info.score : 0;
+}
+
+int gomoku_engine_get_depth(const gomoku_engine* engine) {
+    return engine ? engine->info.depth : 0;
+}
+
+long long gomoku_engine_get_nodes(const gomoku_engine* engine) {
+    return engine ? static_cast<long long>(engine->info.nodes) : 0;
+}
+
+int gomoku_engine_get_pv(const gomoku_engine* engine, gomoku_move* pv, int capacity) {
+    if (!engine) {
+        return 0;
+    }
+    const std::vector<Move>& line = engine->info.principalVariation;
+    for (int i = 0; pv && i < capacity && i < static_cast<int>(line.size()); i++) {
+        pv[i].x = line[i].first;
+        pv[i].y = line[i].second;
+    }
+    return static_cast<int>(line.size());
+}
+
+} // extern "C"
@@ -0,0 +1,69 @@
+#include "latency.hpp"
+#include <algorithm>
+#include <cstdio>
+
+LatencyStats::LatencyStats() {
+    clear();
+}
+
+void LatencyStats::clear() {
+    samples.clear();
+    buckets.fill(0);
+    overBudget = 0;
+    missed = 0;
+}
+
+// budgetMs is the search time limit the move was played with (0 = none)
+void LatencyStats::add(int64_t microseconds, int budgetMs) {
+    samples.push_back(microseconds);
+
+    int bucket = 0;
+    while (bucket < BUCKET_COUNT - 1 && microseconds >= BUCKET_LIMITS_MS[bucket] * 1000LL) {
+        bucket++;
+    }
+    buckets[bucket]++;
+
+    if (budgetMs > 0 && microseconds > budgetMs * 1000LL) {
+        overBudget++;
+    }
+    if (microseconds >= DEADLINE_MS * 1000LL) {
+        missed++;
+    }
+}
+
+std::string LatencyStats::getSummary() const {
+    std::vector<int64_t> sorted = samples;
+    std::sort(sorted.begin(), sorted.end());
+
+    // Nearest rank
+    auto percentile = [&sorted](int percent) {
+        if (sorted.empty()) {
+            return 0.0;
+        }
+        size_t rank = (sorted.size() * percent + 99) / 100;
+        return sorted[std::max<size_t>(rank, 1) - 1] / 1000.0;
+    };
+
+    char text[160];
+    std::snprintf(text, sizeof(text), "moves %d p50 %.1fms p99 %.1fms max %.1fms over-budget %d missed %d",
+                  getMoveCount(), percentile(50), percentile(99), sorted.empty() ? 0.0 : sorted.back() / 1000.0,
+                  overBudget, missed);
+    return text;
+}
+
+std::string LatencyStats::getHistogram() const {
+    std::string text;
+    for (int bucket = 0; bucket < BUCKET_COUNT; bucket++) {
+        char entry[32];
+        if (bucket < BUCKET_COUNT - 1) {
+            std::snprintf(entry, sizeof(entry), "<%dms:%d", BUCKET_LIMITS_MS[bucket], buckets[bucket]);
+        } else {
+            std::snprintf(entry, sizeof(entry), ">=%dms:%d", BUCKET_LIMITS_MS[bucket - 1], buckets[bucket]);
+        }
+        if (bucket > 0) {
+            text += ' ';
+        }
+        text += entry;
+    }
+    return text;
+}
@@ -1,18 +1,154 @@
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
 #include <iostream>
 #include <string>
 #include "protocol.hpp"
-#include "board.hpp"
-#include "ai.hpp"
+#include "analysis.hpp"
+#include "cluster.hpp"
+#include "engine.hpp"
+#include "trace.hpp"
 #include "utils.hpp"
 
-int main() {
+// Search limits from GOMOKU_MAX_DEPTH / GOMOKU_MAX_NODES / GOMOKU_MAX_TIME_MS
+// (same meaning as the INFO keys, 0 = no limit). Returns false on a bad value.
+static bool readLimitsFromEnvironment(SearchLimits& limits) {
+    const char* names[] = {"GOMOKU_MAX_DEPTH", "GOMOKU_MAX_NODES", "GOMOKU_MAX_TIME_MS"};
+
+    for (int i = 0; i < 3; i++) {
+        const char* value = std::getenv(names[i]);
+        if (!value) {
+            continue;
+        }
+        try {
+            long long parsed = std::stoll(value);
+            if (parsed < 0) {
+                throw std::invalid_argument(names[i]);
+            }
+            if (i == 0) limits.depth = static_cast<int>(std::min(parsed, 1000000000LL));
+            if (i == 1) limits.nodes = parsed;
+            if (i == 2) limits.timeMs = static_cast<int>(std::min(parsed, 1000000000LL));
+        } catch (const std::exception&) {
+            std::cerr << "Invalid " << names[i] << ": " << value << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
     // Initialize the bot
     ProtocolHandler protocol;
-    Board board;
-    AI ai;
+    EngineOptions options;
+    std::string analyzeFile; // Batch mode instead of the protocol when set
+    std::string serveAddress; // Cluster worker instead of the protocol when set
+    int jobs = 0;
+
+    if (!readLimitsFromEnvironment(options.limits)) {
+        return 84;
+    }
+
+    // Command-line options (engine selection happens at startup,
+    // the board size is chosen later by START)
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+
+        if (arg == "--mcts") {
+            options.searchMode = SearchMode::MCTS;
+        } else if (arg == "--alphabeta") {
+            options.searchMode = SearchMode::ALPHA_BETA;
+        } else if (arg == "--nnue") {
+            options.evaluation = Evaluation::NNUE;
+        } else if (arg == "--threads" && i + 1 < argc) {
+            try {
+                options.threads = std::stoi(argv[++i]);
+            } catch (const std::exception&) {
+                std::cerr << "Invalid thread count: " << argv[i] << std::endl;
+                return 84;
+            }
+        } else if (arg == "--eval-cache" && i + 1 < argc) {
+            try {
+                options.evalCacheMb = std::stoi(argv[++i]);
+            } catch (const std::exception&) {
+                options.evalCacheMb = -1;
+            }
+            if (options.evalCacheMb < 0 || options.evalCacheMb > EvalCache::MAX_SIZE_MB) {
+                std::cerr << "Invalid evaluation cache size (0-" << EvalCache::MAX_SIZE_MB
+                          << " MB): " << argv[i] << std::endl;
+                return 84;
+            }
+        } else if (arg == "--analyze" && i + 1 < argc) {
+            analyzeFile = argv[++i];
+        } else if (arg == "--record" && i + 1 < argc) {
+            if (!protocol.setRecordFile(argv[++i])) {
+                std::cerr << "Cannot open " << argv[i] << std::endl;
+                return 84;
+            }
+        } else if (arg == "--experience" && i + 1 < argc) {
+            if (!protocol.setExperienceFile(argv[++i])) {
+                std::cerr << "Cannot read " << argv[i] << std::endl;
+                return 84;
+            }
+        } else if (arg == "--trace" && i + 1 < argc) {
+            if (!Trace::start(argv[++i])) {
+#ifdef GOMOKU_TRACE
+                std::cerr << "Cannot open " << argv[i] << std::endl;
+#else
+                std::cerr << "Tracing is not built in (make trace)" << std::endl;
+#endif
+                return 84;
+            }
+        } else if (arg == "--cluster" && i + 1 < argc) {
+            for (const std::string& address : splitString(argv[++i], ',')) {
+                if (!address.empty()) {
+                    options.clusterWorkers.push_back(address);
+                }
+            }
+        } else if (arg == "--serve" && i + 1 < argc) {
+            serveAddress = argv[++i];
+        } else if (arg == "--jobs" && i + 1 < argc) {
+            try {
+                jobs = std::stoi(argv[++i]);
+            } catch (const std::exception&) {
+                std::cerr << "Invalid job count: " << argv[i] << std::endl;
+                return 84;
+            }
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--alphabeta | --mcts] [--nnue] [--threads N] [--eval-cache MB]"
+                      << " [--record FILE] [--experience FILE] [--trace FILE|-] [--analyze FILE|- [--jobs N]]"
+                      << " [--cluster ADDRESS,... | --serve ADDRESS]" << std::endl;
+            return 84;
+        }
+    }
+
+    // Cluster worker: searches for a coordinator (another process's --cluster)
+    if (!serveAddress.empty()) {
+        if (!options.clusterWorkers.empty()) {
+            std::cerr << "--serve and --cluster cannot be combined" << std::endl;
+            return 84;
+        }
+        return ClusterWorker::serve(serveAddress, options) ? 0 : 84;
+    }
+
+    // Batch analysis: positions from a file (or stdin), results on stdout
+    if (!analyzeFile.empty()) {
+        // With a cluster the workers are the parallelism: one position at a time
+        BatchAnalyzer analyzer(options, options.clusterWorkers.empty() ? jobs : 1);
+        if (analyzeFile == "-") {
+            analyzer.run(std::cin, std::cout);
+            return 0;
+        }
+        std::ifstream input(analyzeFile);
+        if (!input) {
+            std::cerr << "Cannot open " << analyzeFile << std::endl;
+            return 84;
+        }
+        analyzer.run(input, std::cout);
+        return 0;
+    }
 
     // Start the main communication loop
-    protocol.runCommunicationLoop(board, ai);
+    protocol.runCommunicationLoop(options);
 
     return 0;
 }
@@ -0,0 +1,567 @@
+#include "mcts.hpp"
+#include <algorithm>
+#include <array>
+#include <barrier>
+#include <cmath>
+#include <thread>
+
+template <int N>
+MCTS<N>::MCTS()
+    : poolUsed(0), rootIndex(-1), rootColor(Cell::BLACK),
+      threadCount(1), playouts(0), stopSearch(false),
+      hasDeadline(true), maxPlayouts(0) {
+}
+
+template <int N>
+void MCTS<N>::setThreads(int threads) {
+    threadCount = std::max(1, threads);
+}
+
+// Drop the whole tree (next search starts from scratch)
+template <int N>
+void MCTS<N>::clear() {
+    poolUsed = 0;
+    rootIndex = -1;
+}
+
+// Reserve `count` contiguous nodes, -1 when the pool is exhausted
+template <int N>
+int32_t MCTS<N>::allocateNodes(int count) {
+    int32_t index = poolUsed.fetch_add(count);
+    if (index + count > NODE_POOL_SIZE) {
+        return -1;
+    }
+    return index;
+}
+
+template <int N>
+void MCTS<N>::initNode(Node& node, int16_t move, float prior, bool terminal) {
+    node.visits.store(0, std::memory_order_relaxed);
+    node.valueSum.store(0.0f, std::memory_order_relaxed);
+    node.firstChild.store(-1, std::memory_order_relaxed);
+    node.state.store(LEAF, std::memory_order_relaxed);
+    node.childCount = 0;
+    node.move = move;
+    node.prior = prior;
+    node.terminal = terminal;
+}
+
+template <int N>
+void MCTS<N>::resetTree(const Board<N>& board, Cell myColor) {
+    // Pool is only allocated once MCTS is actually used
+    if (!pool) {
+        pool.reset(new Node[NODE_POOL_SIZE]);
+    }
+
+    poolUsed = 0;
+    rootIndex = allocateNodes(1);
+    initNode(pool[rootIndex], -1, 1.0f, false);
+    rootBoard = board;
+    rootColor = myColor;
+}
+
+// Try to re-root the previous tree on the new position.
+// Succeeds when the board is the old root plus our move and one reply.
+template <int N>
+bool MCTS<N>::reuseTree(const Board<N>& board, Cell myColor) {
+    if (rootIndex < 0 || rootColor != myColor) {
+        return false;
+    }
+
+    // Keep enough room in the pool for the new search
+    if (poolUsed.load() > NODE_POOL_SIZE / 2) {
+        return false;
+    }
+
+    // The old stones must all still be there, plus at most one of each color
+    Move ourMove(-1, -1);
+    Move theirMove(-1, -1);
+    for (Cell color : {Cell::BLACK, Cell::WHITE}) {
+        for (int cell : rootBoard.getStones(color)) {
+            if (board.getCell(cell % N, cell / N) != color) {
+                return false;
+            }
+        }
+        int added = static_cast<int>(board.getStones(color).size() - rootBoard.getStones(color).size());
+        if (added > 1) {
+            return false;
+        }
+        for (int cell : board.getStones(color)) {
+            if (added == 1 && rootBoard.getCell(cell % N, cell / N) == Cell::EMPTY) {
+                (color == myColor ? ourMove : theirMove) = Move(cell % N, cell / N);
+            }
+        }
+    }
+
+    // Same position searched again
+    if (board.getMoveCount() == rootBoard.getMoveCount()) {
+        return true;
+    }
+
+    if (ourMove.first == -1 || theirMove.first == -1) {
+        return false;
+    }
+
+    // Walk down: root -> our move -> their reply
+    int32_t nodeIndex = rootIndex;
+    const int16_t path[2] = {packMove(ourMove), packMove(theirMove)};
+
+    for (int16_t move : path) {
+        Node& node = pool[nodeIndex];
+        if (node.state.load() != EXPANDED) {
+            return false;
+        }
+
+        int32_t first = node.firstChild.load();
+        int32_t next = -1;
+        for (int i = 0; i < node.childCount; i++) {
+            if (pool[first + i].move == move) {
+                next = first + i;
+                break;
+            }
+        }
+        if (next < 0) {
+            return false;
+        }
+        nodeIndex = next;
+    }
+
+    rootIndex = nodeIndex;
+    rootBoard = board;
+    return true;
+}
+
+// Main entry point - runs playouts until the budget is spent, returns the most visited move
+template <int N>
+Move MCTS<N>::findBestMove(const Board<N>& board, Cell myColor, const SearchLimits& limits,
+                           std::chrono::steady_clock::time_point startTime) {
+    hasDeadline = limits.timeMs > 0;
+    deadline = startTime + std::chrono::milliseconds(limits.timeMs);
+    maxPlayouts = limits.nodes;
+    playouts = 0;
+    stopSearch = false;
+
+    if (!reuseTree(board, myColor)) {
+        resetTree(board, myColor);
+    }
+
+    if (threadCount > 1 && limits.isDeterministic()) {
+        deterministicSearch(board);
+    } else if (threadCount <= 1) {
+        searchWorker(board);
+    } else {
+        std::vector<std::thread> workers;
+        for (int i = 0; i < threadCount; i++) {
+            workers.emplace_back(&MCTS<N>::searchWorker, this, std::cref(board));
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    int32_t best = mostVisitedChild(pool[rootIndex]);
+    return (best < 0) ? Move(-1, -1) : unpackMove(pool[best].move);
+}
+
+// Most visited child, prior breaks ties (-1 if not expanded)
+template <int N>
+int32_t MCTS<N>::mostVisitedChild(const Node& node) const {
+    if (node.state.load() != EXPANDED || node.childCount == 0) {
+        return -1;
+    }
+
+    int32_t first = node.firstChild.load();
+    int32_t best = first;
+    for (int i = 1; i < node.childCount; i++) {
+        const Node& child = pool[first + i];
+        const Node& current = pool[best];
+        if (child.visits.load() > current.visits.load() ||
+            (child.visits.load() == current.visits.load() && child.prior > current.prior)) {
+            best = first + i;
+        }
+    }
+    return best;
+}
+
+// Follow the most visited children while they have been visited
+template <int N>
+void MCTS<N>::getPrincipalVariation(std::vector<Move>& pv, int maxLength) const {
+    pv.clear();
+    if (rootIndex < 0) {
+        return;
+    }
+
+    int32_t nodeIndex = mostVisitedChild(pool[rootIndex]);
+    while (nodeIndex >= 0 && static_cast<int>(pv.size()) < maxLength &&
+           pool[nodeIndex].visits.load() > 0) {
+        pv.push_back(unpackMove(pool[nodeIndex].move));
+        nodeIndex = mostVisitedChild(pool[nodeIndex]);
+    }
+}
+
+// Mean value of the chosen move, inverse of the leaf squashing (tanh)
+template <int N>
+int MCTS<N>::getScore() const {
+    if (rootIndex < 0) {
+        return 0;
+    }
+    int32_t best = mostVisitedChild(pool[rootIndex]);
+    if (best < 0 || pool[best].visits.load() == 0) {
+        return 0;
+    }
+
+    float value = pool[best].valueSum.load() / pool[best].visits.load();
+    value = std::clamp(value, -0.999f, 0.999f);
+    return static_cast<int>(std::atanh(value) * EVAL_SCALE);
+}
+
+// Playout budget: node limit, or a full pool when there is no clock to stop us
+template <int N>
+bool MCTS<N>::budgetExhausted() const {
+    if (maxPlayouts > 0 && playouts.load(std::memory_order_relaxed) >= maxPlayouts) {
+        return true;
+    }
+    return !hasDeadline && maxPlayouts == 0 && poolUsed.load(std::memory_order_relaxed) >= NODE_POOL_SIZE;
+}
+
+// One search thread: repeated playouts on a private board copy
+template <int N>
+void MCTS<N>::searchWorker(const Board<N>& board) {
+    Board<N> localBoard = board;
+
+    while (!stopSearch.load(std::memory_order_relaxed)) {
+        if ((hasDeadline && std::chrono::steady_clock::now() >= deadline) || budgetExhausted()) {
+            stopSearch = true;
+            break;
+        }
+        playout(localBoard);
+        playouts++;
+    }
+}
+
+// Multi-threaded search that does not depend on scheduling. Playouts run in
+// rounds of one per thread: leaves are selected in slot order (virtual loss
+// spreads them), scored in parallel without touching the tree, then children
+// are created and values backed up in slot order by the barrier completion.
+template <int N>
+void MCTS<N>::deterministicSearch(const Board<N>& board) {
+    std::vector<PlayoutSlot> slots(threadCount);
+    for (auto& slot : slots) {
+        slot.board = board;
+    }
+    int batchSize = 0;
+
+    auto selectBatch = [&]() {
+        batchSize = 0;
+        if (budgetExhausted()) {
+            stopSearch = true;
+            return;
+        }
+        int64_t remaining = (maxPlayouts > 0) ? maxPlayouts - playouts.load() : threadCount;
+        batchSize = static_cast<int>(std::min<int64_t>(threadCount, remaining));
+        for (int i = 0; i < batchSize; i++) {
+            slots[i].action = selectLeaf(slots[i].board, slots[i].path, slots[i].toMove);
+        }
+    };
+
+    auto finishBatch = [&]() noexcept {
+        for (int i = 0; i < batchSize; i++) {
+            PlayoutSlot& slot = slots[i];
+            float value = 1.0f;
+            if (slot.action != LeafAction::TERMINAL) {
+                value = -slot.leafValue;
+            }
+            // The same leaf may have been picked twice: first slot expands it
+            if (slot.action == LeafAction::EXPAND) {
+                createChildren(pool[slot.path.nodes[slot.path.length - 1]], slot.candidates);
+            }
+            backpropagate(slot.board, slot.path, value);
+            playouts++;
+        }
+        selectBatch();
+    };
+
+    selectBatch();
+    std::barrier sync(threadCount, finishBatch);
+
+    auto worker = [&](int id) {
+        while (!stopSearch.load()) {
+            if (id < batchSize) {
+                PlayoutSlot& slot = slots[id];
+                if (slot.action == LeafAction::EXPAND) {
+                    scoreCandidates(slot.board, slot.toMove, slot.candidates, slot.leafValue);
+                } else if (slot.action == LeafAction::EVALUATE) {
+                    slot.leafValue = evaluateLeaf(slot.board, slot.toMove);
+                }
+            }
+            sync.arrive_and_wait();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (int i = 1; i < threadCount; i++) {
+        workers.emplace_back(worker, i);
+    }
+    worker(0);
+    for (auto& thread : workers) {
+        thread.join();
+    }
+}
+
+// Selection -> expansion/evaluation -> backpropagation
+template <int N>
+void MCTS<N>::playout(Board<N>& board) {
+    Path path;
+    Cell toMove;
+
+    // Value from the point of view of the player who moved into the last node
+    float value = 0.0f;
+
+    switch (selectLeaf(board, path, toMove)) {
+        case LeafAction::TERMINAL:
+            value = 1.0f;
+            break;
+        case LeafAction::EXPAND: {
+            float leafValue = 0.0f;
+            expand(pool[path.nodes[path.length - 1]], board, toMove, leafValue);
+            value = -leafValue;
+            break;
+        }
+        case LeafAction::EVALUATE:
+            value = -evaluateLeaf(board, toMove);
+            break;
+    }
+
+    backpropagate(board, path, value);
+}
+
+// Walk down with PUCT, placing stones on board and adding virtual loss
+template <int N>
+typename MCTS<N>::LeafAction MCTS<N>::selectLeaf(Board<N>& board, Path& path, Cell& toMove) {
+    int32_t nodeIndex = rootIndex;
+    toMove = rootColor;
+    path.length = 0;
+    path.nodes[path.length++] = nodeIndex;
+
+    while (true) {
+        Node& node = pool[nodeIndex];
+
+        if (node.terminal) {
+            return LeafAction::TERMINAL;
+        }
+
+        if (node.state.load(std::memory_order_acquire) != EXPANDED) {
+            return LeafAction::EXPAND;
+        }
+
+        int32_t child = selectChild(node);
+        if (child < 0) {
+            return LeafAction::EVALUATE;
+        }
+
+        // Virtual loss steers other threads away from this path
+        Node& next = pool[child];
+        next.visits.fetch_add(VIRTUAL_LOSS, std::memory_order_relaxed);
+        next.valueSum.fetch_sub(static_cast<float>(VIRTUAL_LOSS), std::memory_order_relaxed);
+
+        Move move = unpackMove(next.move);
+        board.placeStone(move.first, move.second, toMove);
+        toMove = opponentOf(toMove);
+        nodeIndex = child;
+        path.nodes[path.length++] = nodeIndex;
+    }
+}
+
+// Backpropagate, flipping perspective at each ply, and undo the stones
+template <int N>
+void MCTS<N>::backpropagate(Board<N>& board, const Path& path, float value) {
+    for (int i = path.length - 1; i >= 0; i--) {
+        Node& node = pool[path.nodes[i]];
+        if (i > 0) {
+            node.visits.fetch_add(1 - VIRTUAL_LOSS, std::memory_order_relaxed);
+            node.valueSum.fetch_add(value + VIRTUAL_LOSS, std::memory_order_relaxed);
+
+            Move move = unpackMove(node.move);
+            board.removeStone(move.first, move.second);
+        } else {
+            node.visits.fetch_add(1, std::memory_order_relaxed);
+            node.valueSum.fetch_add(value, std::memory_order_relaxed);
+        }
+        value = -value;
+    }
+}
+
+// PUCT: Q + c * P * sqrt(N) / (1 + n)
+template <int N>
+int32_t MCTS<N>::selectChild(const Node& node) const {
+    int32_t first = node.firstChild.load(std::memory_order_acquire);
+    if (first < 0 || node.childCount == 0) {
+        return -1;
+    }
+
+    float sqrtParent = std::sqrt(static_cast<float>(std::max(1, node.visits.load(std::memory_order_relaxed))));
+    float bestScore = -1e30f;
+    int32_t best = first;
+
+    for (int i = 0; i < node.childCount; i++) {
+        const Node& child = pool[first + i];
+        int visits = child.visits.load(std::memory_order_relaxed);
+        float q = (visits > 0) ? child.valueSum.load(std::memory_order_relaxed) / visits : 0.0f;
+        float u = C_PUCT * child.prior * sqrtParent / (1.0f + visits);
+
+        if (q + u > bestScore) {
+            bestScore = q + u;
+            best = first + i;
+        }
+    }
+
+    return best;
+}
+
+// Score candidates with pattern probes, evaluate the leaf, and create children.
+// leafValue is always set (from toMove's point of view); returns false if
+// another thread owns the expansion or the pool is full.
+template <int N>
+bool MCTS<N>::expand(Node& node, Board<N>& board, Cell toMove, float& leafValue) {
+    CandidateList candidates;
+    scoreCandidates(board, toMove, candidates, leafValue);
+    return createChildren(node, candidates);
+}
+
+// Pattern scores of the moves near existing stones plus the leaf value.
+// Reads the tree-independent position only (safe to run in parallel).
+template <int N>
+void MCTS<N>::scoreCandidates(Board<N>& board, Cell toMove, CandidateList& candidates,
+                              float& leafValue) const {
+    Cell opponent = opponentOf(toMove);
+
+    candidates.count = 0;
+    candidates.canWin = false;
+    candidates.opponentWins = 0;
+
+    // Only consider moves near existing stones: inside their bounding box
+    // grown by 2 (every cell on an empty board)
+    BoardArea area = (board.getMoveCount() == 0) ? BoardArea{0, 0, N - 1, N - 1} : board.getStoneArea(2);
+    for (int y = area.minY; y <= area.maxY; y++) {
+        for (int x = area.minX; x <= area.maxX; x++) {
+            if (board.getCell(x, y) != Cell::EMPTY) {
+                continue;
+            }
+
+            bool hasNeighbor = board.getMoveCount() == 0;
+            for (int dy = -2; dy <= 2 && !hasNeighbor; dy++) {
+                for (int dx = -2; dx <= 2; dx++) {
+                    Cell cell = board.getCell(x + dx, y + dy);
+                    if ((dx != 0 || dy != 0) && cell != Cell::EMPTY) {
+                        hasNeighbor = true;
+                        break;
+                    }
+                }
+            }
+            if (!hasNeighbor) {
+                continue;
+            }
+
+            // Threat map reads: the same as placing each color's stone and probing
+            uint8_t mine = board.getThreats(x, y, toMove);
+            uint8_t theirs = board.getThreats(x, y, opponent);
+            int score = 0;
+
+            if (mine & THREAT_FIVE) {
+                score += 1000000;
+                candidates.canWin = true;
+            }
+            if (mine & THREAT_STRAIGHT_FOUR) score += 100000;
+            if (mine & THREAT_ANY_FOUR) score += 50000;
+            if (mine & THREAT_OPEN_THREE) score += 10000;
+            if (mine & THREAT_ANY) score += 5000;
+
+            if (theirs & THREAT_FIVE) {
+                score += 500000;
+                candidates.opponentWins++;
+            }
+            if (theirs & THREAT_STRAIGHT_FOUR) score += 80000;
+            if (theirs & THREAT_OPEN_THREE) score += 8000;
+
+            int centerDist = std::abs(x - Board<N>::CENTER) + std::abs(y - Board<N>::CENTER);
+            score += (40 - centerDist) * 10;
+
+            candidates.entries[candidates.count++] = {score, packMove(Move(x, y))};
+        }
+    }
+
+    // Tactical leaf value, static evaluation otherwise
+    if (candidates.canWin) {
+        leafValue = 1.0f;
+    } else if (candidates.opponentWins >= 2) {
+        leafValue = -1.0f;
+    } else {
+        leafValue = evaluateLeaf(board, toMove);
+    }
+}
+
+// Turn scored candidates into children (best MAX_CHILDREN, only blocks when
+// a reply is forced). Fails if the node is already being expanded.
+template <int N>
+bool MCTS<N>::createChildren(Node& node, CandidateList& list) {
+    int candidateCount = list.count;
+    if (candidateCount == 0) {
+        return false;
+    }
+
+    uint8_t expected = LEAF;
+    if (!node.state.compare_exchange_strong(expected, EXPANDING)) {
+        return false;
+    }
+
+    // Forced reply: only blocks are worth considering
+    if (!list.canWin && list.opponentWins > 0) {
+        auto end = std::remove_if(list.entries.begin(), list.entries.begin() + candidateCount,
+                                  [](const auto& c) { return c.first < 500000; });
+        candidateCount = static_cast<int>(end - list.entries.begin());
+    }
+
+    int keep = std::min(candidateCount, MAX_CHILDREN);
+    std::partial_sort(list.entries.begin(), list.entries.begin() + keep,
+                      list.entries.begin() + candidateCount,
+                      [](const auto& a, const auto& b) { return a.first > b.first; });
+
+    int32_t first = allocateNodes(keep);
+    if (first < 0) {
+        node.state.store(LEAF, std::memory_order_release);
+        return false;
+    }
+
+    // Priors proportional to sqrt(pattern score)
+    float total = 0.0f;
+    for (int i = 0; i < keep; i++) {
+        total += std::sqrt(static_cast<float>(std::max(0, list.entries[i].first))) + 1.0f;
+    }
+    for (int i = 0; i < keep; i++) {
+        float weight = std::sqrt(static_cast<float>(std::max(0, list.entries[i].first))) + 1.0f;
+        initNode(pool[first + i], list.entries[i].second, weight / total,
+                 list.entries[i].first >= 1000000);
+    }
+
+    node.childCount = static_cast<int16_t>(keep);
+    node.firstChild.store(first, std::memory_order_release);
+    node.state.store(EXPANDED, std::memory_order_release);
+    return true;
+}
+
+// Static pattern evaluation squashed to [-1, 1] for the side to move
+template <int N>
+float MCTS<N>::evaluateLeaf(const Board<N>& board, Cell toMove) const {
+    int blackScore = 0;
+    int whiteScore = 0;
+    PatternDetector<N>::evaluateBoard(board, blackScore, whiteScore);
+
+    int myScore = (toMove == Cell::BLACK) ? blackScore : whiteScore;
+    int opponentScore = (toMove == Cell::BLACK) ? whiteScore : blackScore;
+    float score = myScore - (opponentScore * static_cast<float>(DEFENSE_WEIGHT));
+    return std::tanh(score / EVAL_SCALE);
+}
+
+// Supported sizes
+template class MCTS<15>;
+template class MCTS<20>;
@@ -0,0 +1,268 @@
+#include "movepicker.hpp"
+#include "pattern.hpp"
+#include <algorithm>
+#include <cstdlib>
+
+template <int N>
+MovePicker<N>::MovePicker(const Board<N>& board, Cell player, MoveList& moves,
+                          Move ttMove, const std::array<Move, 2>& killers,
+                          const int* history, int quietLimit)
+    : board(board), player(player),
+      opponent(player == Cell::BLACK ? Cell::WHITE : Cell::BLACK),
+      ttMove(ttMove), killers(killers), history(history), stage(Stage::CLASSIFY),
+      candidates(moves), cursor(0), killerIndex(0), quietCount(0), quietLimit(quietLimit), forced(false) {
+    picked.fill(false);
+}
+
+template <int N>
+bool MovePicker<N>::emit(Move candidate, Move& move) {
+    picked[candidate.second * N + candidate.first] = true;
+    move = candidate;
+    return true;
+}
+
+// Tactical pass: two threat map reads per candidate
+template <int N>
+void MovePicker<N>::classify() {
+    forced = restrictToForced(board, player, candidates);
+
+    for (int c = 0; c < candidates.size(); c++) {
+        Move move = candidates[c];
+        uint8_t mine = board.getThreats(move.first, move.second, player);
+        uint8_t theirs = board.getThreats(move.first, move.second, opponent);
+
+        flags[c] = 0;
+        if (mine & THREAT_FIVE) flags[c] |= WINS;
+        if (theirs & THREAT_FIVE) flags[c] |= BLOCKS_WIN;
+        if ((mine & THREAT_ANY_FOUR) && !(mine & THREAT_FIVE)) flags[c] |= MAKES_FOUR;
+        if ((mine & (THREAT_ANY_FOUR | THREAT_OPEN_THREE)) ||
+            (theirs & (THREAT_FIVE | THREAT_STRAIGHT_FOUR))) flags[c] |= FORCING;
+    }
+}
+
+template <int N>
+bool MovePicker<N>::nextWithFlag(uint8_t flag, Move& move) {
+    while (cursor < candidates.size()) {
+        int index = cursor++;
+        if ((flags[index] & flag) && !isPicked(candidates[index])) {
+            return emit(candidates[index], move);
+        }
+    }
+    cursor = 0;
+    return false;
+}
+
+template <int N>
+bool MovePicker<N>::next(Move& move) {
+    while (true) {
+        switch (stage) {
+            case Stage::CLASSIFY:
+                classify();
+                stage = Stage::TT_MOVE;
+                break;
+
+            case Stage::TT_MOVE:
+                stage = Stage::WINNING;
+                if (board.isValidMove(ttMove.first, ttMove.second) &&
+                    (!forced || candidates.indexOf(ttMove) >= 0)) {
+                    return emit(ttMove, move);
+                }
+                break;
+
+            case Stage::WINNING:
+                if (nextWithFlag(WINS, move)) return true;
+                stage = Stage::BLOCKS;
+                break;
+
+            case Stage::BLOCKS:
+                if (nextWithFlag(BLOCKS_WIN, move)) return true;
+                stage = Stage::FOURS;
+                break;
+
+            case Stage::FOURS:
+                if (nextWithFlag(MAKES_FOUR, move)) return true;
+                stage = Stage::KILLERS;
+                break;
+
+            case Stage::KILLERS:
+                while (killerIndex < 2 && !forced && quietCount < quietLimit) {
+                    Move killer = killers[killerIndex++];
+                    if (board.isValidMove(killer.first, killer.second) && !isPicked(killer)) {
+                        quietCount++;
+                        return emit(killer, move);
+                    }
+                }
+                stage = Stage::SCORE_QUIET;
+                break;
+
+            case Stage::SCORE_QUIET:
+                for (int c = 0; c < candidates.size(); c++) {
+                    Move candidate = candidates[c];
+                    if (!isPicked(candidate)) {
+                        int score = scoreMove(board, candidate, player);
+                        if (history) {
+                            score += history[candidate.second * N + candidate.first];
+                        }
+                        candidates.setScore(c, score);
+                    }
+                }
+                stage = Stage::QUIET;
+                break;
+
+            case Stage::QUIET: {
+                // Partial selection sort: bring the best remaining to the front
+                bool pruning = !forced && quietCount >= quietLimit;
+                int best = -1;
+                for (int c = cursor; c < candidates.size(); c++) {
+                    if (!isPicked(candidates[c]) && (!pruning || (flags[c] & FORCING)) &&
+                        (best < 0 || candidates.getScore(c) > candidates.getScore(best))) {
+                        best = c;
+                    }
+                }
+                if (best < 0) {
+                    stage = Stage::DONE;
+                    break;
+                }
+                candidates.swap(cursor, best);
+                std::swap(flags[cursor], flags[best]);
+                quietCount++;
+                return emit(candidates[cursor++], move);
+            }
+
+            case Stage::DONE:
+                return false;
+        }
+    }
+}
+
+// Heuristic move score (win, block, patterns created / prevented, center),
+// from the threat map of both colors
+template <int N>
+int MovePicker<N>::scoreMove(const Board<N>& board, Move move, Cell player) {
+    Cell opponent = (player == Cell::BLACK) ? Cell::WHITE : Cell::BLACK;
+    int x = move.first;
+    int y = move.second;
+    uint8_t mine = board.getThreats(x, y, player);
+    uint8_t theirs = board.getThreats(x, y, opponent);
+    int score = 0;
+
+    // Winning move, then blocks of the opponent's win
+    if (mine & THREAT_FIVE) score += 1000000;
+    if (theirs & THREAT_FIVE) score += 500000;
+
+    // Check pattern strength
+    if (mine & THREAT_STRAIGHT_FOUR) score += 100000;
+    if (mine & THREAT_OPEN_THREE) score += 10000;
+    if (mine & THREAT_ANY_FOUR) score += 50000;
+    if (mine & THREAT_ANY) score += 5000;
+
+    // Check opponent patterns (defense)
+    if (theirs & THREAT_STRAIGHT_FOUR) score += 80000;
+    if (theirs & THREAT_OPEN_THREE) score += 8000;
+
+    // Two threats at once: four-three / double-four win like a straight four
+    if ((mine | theirs) & (THREAT_ANY_FOUR | THREAT_OPEN_THREE)) {
+        MoveThreat own = PatternDetector<N>::classifyMove(board, x, y, player);
+        MoveThreat other = PatternDetector<N>::classifyMove(board, x, y, opponent);
+        if (own == MoveThreat::DOUBLE_FOUR || own == MoveThreat::FOUR_THREE) score += 90000;
+        if (own == MoveThreat::DOUBLE_THREE) score += 20000;
+        if (other == MoveThreat::DOUBLE_FOUR || other == MoveThreat::FOUR_THREE) score += 70000;
+        if (other == MoveThreat::DOUBLE_THREE) score += 15000;
+    }
+
+    // Prefer center
+    int centerDist = std::abs(x - Board<N>::CENTER) + std::abs(y - Board<N>::CENTER);
+    score += (40 - centerDist) * 10;
+
+    return score;
+}
+
+template <int N>
+bool MovePicker<N>::isForcing(const Board<N>& board, Move move, Cell player) {
+    Cell opponent = (player == Cell::BLACK) ? Cell::WHITE : Cell::BLACK;
+    return (board.getThreats(move.first, move.second, player) & (THREAT_ANY_FOUR | THREAT_OPEN_THREE)) ||
+           (board.getThreats(move.first, move.second, opponent) & (THREAT_FIVE | THREAT_STRAIGHT_FOUR));
+}
+
+template <int N>
+bool MovePicker<N>::restrictToForced(const Board<N>& board, Cell player, MoveList& moves) {
+    static const int MAX_STRAIGHT_FOURS = 16;
+    Cell opponent = (player == Cell::BLACK) ? Cell::WHITE : Cell::BLACK;
+    bool canWin = false;
+    bool mustBlock = false;
+    std::array<Move, MAX_STRAIGHT_FOURS> straightFours;
+    int straightFourCount = 0;
+
+    for (int c = 0; c < moves.size(); c++) {
+        Move move = moves[c];
+        canWin |= (board.getThreats(move.first, move.second, player) & THREAT_FIVE) != 0;
+        uint8_t theirs = board.getThreats(move.first, move.second, opponent);
+        mustBlock |= (theirs & THREAT_FIVE) != 0;
+        if ((theirs & THREAT_STRAIGHT_FOUR) && straightFourCount <= MAX_STRAIGHT_FOURS) {
+            if (straightFourCount < MAX_STRAIGHT_FOURS) {
+                straightFours[straightFourCount] = move;
+            }
+            straightFourCount++;
+        }
+    }
+    if (!canWin && !mustBlock && (straightFourCount == 0 || straightFourCount > MAX_STRAIGHT_FOURS)) {
+        return false;
+    }
+
+    int kept = 0;
+    for (int c = 0; c < moves.size(); c++) {
+        Move move = moves[c];
+        uint8_t mine = board.getThreats(move.first, move.second, player);
+        bool keep;
+        if (canWin) {
+            keep = mine & THREAT_FIVE;
+        } else if (mustBlock) {
+            keep = board.getThreats(move.first, move.second, opponent) & THREAT_FIVE;
+        } else {
+            keep = (mine & THREAT_ANY_FOUR) || defends(board, opponent, move, straightFours.data(), straightFourCount);
+        }
+        if (keep) {
+            moves.swap(kept++, c);
+        }
+    }
+
+    // Several open threes with no common defense: nothing to restrict to
+    if (kept == 0) {
+        return false;
+    }
+    moves.truncate(kept);
+    return true;
+}
+
+// Whether our stone on move leaves the opponent no straight-four cell.
+// Only the line through both cells changes, probed with move blocked.
+template <int N>
+bool MovePicker<N>::defends(const Board<N>& board, Cell opponent, Move move,
+                            const Move* straightFours, int count) {
+    for (int i = 0; i < count; i++) {
+        Move cell = straightFours[i];
+        int dx = cell.first - move.first;
+        int dy = cell.second - move.second;
+        if (dx == 0 && dy == 0) {
+            continue;
+        }
+
+        int direction = (dy == 0) ? 0 : (dx == 0) ? 1 : (dx == dy) ? 2 : (dx == -dy) ? 3 : -1;
+        if (direction < 0 || std::max(std::abs(dx), std::abs(dy)) > 4) {
+            return false;
+        }
+        for (int d = 0; d < 4; d++) {
+            uint8_t line = (d == direction)
+                ? board.probeLineThreats(cell.first, cell.second, d, opponent, move.first, move.second)
+                : board.getLineThreats(cell.first, cell.second, d, opponent);
+            if (line & THREAT_STRAIGHT_FOUR) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Supported sizes
+template class MovePicker<15>;
+template class MovePicker<20>;
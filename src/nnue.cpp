@@ -0,0 +1,295 @@
+#include "nnue.hpp"
+#include <algorithm>
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define NNUE_X86 1
+#endif
+
+namespace {
+
+// Blob layout (little-endian), base64 encoded in nnue_weights.cpp:
+//   "GNNU" version boardSize accumulatorSize hiddenSize   (uint8 each)
+//   int16 featureWeights[2 * N * N][accumulatorSize]
+//   int16 featureBias[accumulatorSize]
+//   int8  hiddenWeights[hiddenSize][2 * accumulatorSize]
+//   int32 hiddenBias[hiddenSize]
+//   int8  outputWeights[hiddenSize]
+//   int32 outputBias
+const char BLOB_MAGIC[4] = {'G', 'N', 'N', 'U'};
+const uint8_t BLOB_VERSION = 1;
+const size_t BLOB_HEADER_SIZE = 8;
+
+const char BASE64_ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+std::string encodeBase64(const std::vector<uint8_t>& bytes) {
+    std::string text;
+    text.reserve((bytes.size() + 2) / 3 * 4);
+    for (size_t i = 0; i < bytes.size(); i += 3) {
+        uint32_t chunk = static_cast<uint32_t>(bytes[i]) << 16;
+        if (i + 1 < bytes.size()) chunk |= static_cast<uint32_t>(bytes[i + 1]) << 8;
+        if (i + 2 < bytes.size()) chunk |= bytes[i + 2];
+        text += BASE64_ALPHABET[(chunk >> 18) & 63];
+        text += BASE64_ALPHABET[(chunk >> 12) & 63];
+        text += (i + 1 < bytes.size()) ? BASE64_ALPHABET[(chunk >> 6) & 63] : '=';
+        text += (i + 2 < bytes.size()) ? BASE64_ALPHABET[chunk & 63] : '=';
+    }
+    return text;
+}
+
+bool decodeBase64(const char* text, std::vector<uint8_t>& bytes) {
+    uint32_t chunk = 0;
+    int bits = 0;
+    bytes.clear();
+    for (const char* p = text; *p && *p != '='; p++) {
+        const char* found = std::strchr(BASE64_ALPHABET, *p);
+        if (!found) {
+            return false;
+        }
+        chunk = (chunk << 6) | static_cast<uint32_t>(found - BASE64_ALPHABET);
+        bits += 6;
+        if (bits >= 8) {
+            bits -= 8;
+            bytes.push_back(static_cast<uint8_t>(chunk >> bits));
+        }
+    }
+    return true;
+}
+
+// Sequential little-endian reader over the decoded blob
+class BlobReader {
+    private:
+        const std::vector<uint8_t>& bytes;
+        size_t offset;
+
+    public:
+        BlobReader(const std::vector<uint8_t>& data, size_t start) : bytes(data), offset(start) {}
+
+        bool done() const { return offset == bytes.size(); }
+
+        template <typename T>
+        bool read(T* values, size_t count) {
+            if (offset + count * sizeof(T) > bytes.size()) {
+                return false;
+            }
+            for (size_t i = 0; i < count; i++) {
+                uint32_t value = 0;
+                for (size_t b = 0; b < sizeof(T); b++) {
+                    value |= static_cast<uint32_t>(bytes[offset++]) << (8 * b);
+                }
+                values[i] = static_cast<T>(value);
+            }
+            return true;
+        }
+};
+
+template <typename T>
+void writeValues(std::vector<uint8_t>& bytes, const T* values, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        uint32_t value = static_cast<uint32_t>(values[i]);
+        for (size_t b = 0; b < sizeof(T); b++) {
+            bytes.push_back(static_cast<uint8_t>(value >> (8 * b)));
+        }
+    }
+}
+
+// Layers after the accumulator. Both versions compute exactly the same integers.
+constexpr int INPUT_SIZE = 2 * NNUE_ACCUMULATOR_SIZE;
+constexpr int HIDDEN_SIZE = Nnue<20>::HIDDEN_SIZE;
+constexpr int WEIGHT_SHIFT = Nnue<20>::WEIGHT_SHIFT;
+constexpr int ACTIVATION_MAX = Nnue<20>::ACTIVATION_MAX;
+
+struct OutputLayers {
+    const int8_t* hiddenWeights;
+    const int32_t* hiddenBias;
+    const int8_t* outputWeights;
+    int32_t outputBias;
+};
+
+using ForwardKernel = int32_t (*)(const int16_t* us, const int16_t* them, const OutputLayers& layers);
+
+int32_t forwardScalar(const int16_t* us, const int16_t* them, const OutputLayers& layers) {
+    uint8_t input[INPUT_SIZE];
+    for (int i = 0; i < NNUE_ACCUMULATOR_SIZE; i++) {
+        input[i] = static_cast<uint8_t>(std::clamp<int>(us[i], 0, ACTIVATION_MAX));
+        input[NNUE_ACCUMULATOR_SIZE + i] = static_cast<uint8_t>(std::clamp<int>(them[i], 0, ACTIVATION_MAX));
+    }
+
+    int32_t output = layers.outputBias;
+    for (int j = 0; j < HIDDEN_SIZE; j++) {
+        const int8_t* row = layers.hiddenWeights + j * INPUT_SIZE;
+        int32_t sum = layers.hiddenBias[j];
+        for (int i = 0; i < INPUT_SIZE; i++) {
+            sum += row[i] * input[i];
+        }
+        output += layers.outputWeights[j] * std::clamp(sum >> WEIGHT_SHIFT, 0, ACTIVATION_MAX);
+    }
+    return output;
+}
+
+#ifdef NNUE_X86
+
+static_assert(NNUE_ACCUMULATOR_SIZE == 32 && HIDDEN_SIZE % 8 == 0, "AVX2 forward expects 32 x 2 inputs");
+
+// 32 int16 -> 32 uint8 clipped to [0, 127], in order
+__attribute__((target("avx2")))
+inline __m256i clipAccumulatorAVX2(const int16_t* values) {
+    __m256i lo = _mm256_load_si256(reinterpret_cast<const __m256i*>(values));
+    __m256i hi = _mm256_load_si256(reinterpret_cast<const __m256i*>(values + 16));
+    __m256i packed = _mm256_min_epu8(_mm256_packus_epi16(lo, hi), _mm256_set1_epi8(ACTIVATION_MAX));
+    return _mm256_permute4x64_epi64(packed, 0xD8); // packus interleaves the 128-bit halves
+}
+
+// Dot products of one row (64 uint8 x int8), as 8 partial int32 sums
+__attribute__((target("avx2")))
+inline __m256i dotRowAVX2(__m256i in0, __m256i in1, const int8_t* row) {
+    const __m256i ones = _mm256_set1_epi16(1);
+    // Pairs of products fit int16 (127 * 127 * 2), widen before adding more
+    __m256i a = _mm256_madd_epi16(_mm256_maddubs_epi16(in0, _mm256_load_si256(reinterpret_cast<const __m256i*>(row))), ones);
+    __m256i b = _mm256_madd_epi16(_mm256_maddubs_epi16(in1, _mm256_load_si256(reinterpret_cast<const __m256i*>(row + 32))), ones);
+    return _mm256_add_epi32(a, b);
+}
+
+__attribute__((target("avx2")))
+int32_t forwardAVX2(const int16_t* us, const int16_t* them, const OutputLayers& layers) {
+    __m256i in0 = clipAccumulatorAVX2(us);
+    __m256i in1 = clipAccumulatorAVX2(them);
+    __m256i output = _mm256_setzero_si256();
+
+    // 8 hidden units per step, reduced together with horizontal adds
+    for (int j = 0; j < HIDDEN_SIZE; j += 8) {
+        __m256i r[8];
+        for (int k = 0; k < 8; k++) {
+            r[k] = dotRowAVX2(in0, in1, layers.hiddenWeights + (j + k) * INPUT_SIZE);
+        }
+        __m256i t = _mm256_hadd_epi32(_mm256_hadd_epi32(r[0], r[1]), _mm256_hadd_epi32(r[2], r[3]));
+        __m256i u = _mm256_hadd_epi32(_mm256_hadd_epi32(r[4], r[5]), _mm256_hadd_epi32(r[6], r[7]));
+        __m256i sums = _mm256_add_epi32(_mm256_permute2x128_si256(t, u, 0x20),
+                                        _mm256_permute2x128_si256(t, u, 0x31));
+
+        sums = _mm256_add_epi32(sums, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(layers.hiddenBias + j)));
+        sums = _mm256_srai_epi32(sums, WEIGHT_SHIFT);
+        sums = _mm256_min_epi32(_mm256_max_epi32(sums, _mm256_setzero_si256()), _mm256_set1_epi32(ACTIVATION_MAX));
+
+        __m128i packedWeights = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(layers.outputWeights + j));
+        __m256i weights = _mm256_cvtepi8_epi32(packedWeights);
+        output = _mm256_add_epi32(output, _mm256_mullo_epi32(sums, weights));
+    }
+
+    __m128i half = _mm_add_epi32(_mm256_castsi256_si128(output), _mm256_extracti128_si256(output, 1));
+    half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0x4E));
+    half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0xB1));
+    return layers.outputBias + _mm_cvtsi128_si32(half);
+}
+
+#endif // NNUE_X86
+
+// Pick the widest implementation the CPU supports (once)
+struct ForwardChoice {
+    ForwardKernel kernel;
+    const char* name;
+};
+
+ForwardChoice selectForward() {
+#ifdef NNUE_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return {forwardAVX2, "avx2"};
+    }
+#endif
+    return {forwardScalar, "scalar"};
+}
+
+const ForwardChoice activeForward = selectForward();
+
+// Network embedded for this size, if any
+template <int N>
+typename Nnue<N>::Weights loadEmbeddedNetwork() {
+    typename Nnue<N>::Weights weights;
+    for (int i = 0; i < NNUE_BLOB_COUNT; i++) {
+        if (NNUE_BLOBS[i].boardSize == N && Nnue<N>::decodeBlob(NNUE_BLOBS[i].base64, weights)) {
+            break;
+        }
+    }
+    return weights;
+}
+
+} // namespace
+
+template <int N>
+typename Nnue<N>::Weights Nnue<N>::network = loadEmbeddedNetwork<N>();
+
+// Empty board: both perspectives hold the bias
+template <int N>
+void Nnue<N>::resetAccumulator(NnueAccumulator& accumulator) {
+    for (auto& values : accumulator.values) {
+        if (network.loaded) {
+            values = network.featureBias;
+        } else {
+            values.fill(0);
+        }
+    }
+}
+
+template <int N>
+int Nnue<N>::evaluate(const NnueAccumulator& accumulator, Cell sideToMove) {
+    if (!network.loaded) {
+        return 0;
+    }
+    int us = (sideToMove == Cell::BLACK) ? 0 : 1;
+    OutputLayers layers = {network.hiddenWeights.data(), network.hiddenBias.data(),
+                           network.outputWeights.data(), network.outputBias};
+    int64_t output = activeForward.kernel(accumulator.values[us].data(),
+                                          accumulator.values[1 - us].data(), layers);
+    // Output is in units of 1 / (64 * 127) logit
+    return static_cast<int>(output * OUTPUT_SCALE / ((1 << WEIGHT_SHIFT) * ACTIVATION_MAX));
+}
+
+template <int N>
+const char* Nnue<N>::getForwardName() {
+    return activeForward.name;
+}
+
+template <int N>
+bool Nnue<N>::decodeBlob(const char* base64, Weights& weights) {
+    std::vector<uint8_t> bytes;
+    weights.loaded = false;
+    if (!decodeBase64(base64, bytes) || bytes.size() < BLOB_HEADER_SIZE ||
+        std::memcmp(bytes.data(), BLOB_MAGIC, 4) != 0 || bytes[4] != BLOB_VERSION ||
+        bytes[5] != N || bytes[6] != ACCUMULATOR_SIZE || bytes[7] != HIDDEN_SIZE) {
+        return false;
+    }
+
+    BlobReader reader(bytes, BLOB_HEADER_SIZE);
+    weights.featureWeights.resize(static_cast<size_t>(FEATURE_COUNT) * ACCUMULATOR_SIZE);
+    bool valid = reader.read(weights.featureWeights.data(), weights.featureWeights.size()) &&
+                 reader.read(weights.featureBias.data(), weights.featureBias.size()) &&
+                 reader.read(weights.hiddenWeights.data(), weights.hiddenWeights.size()) &&
+                 reader.read(weights.hiddenBias.data(), weights.hiddenBias.size()) &&
+                 reader.read(weights.outputWeights.data(), weights.outputWeights.size()) &&
+                 reader.read(&weights.outputBias, 1) && reader.done();
+    weights.loaded = valid;
+    return valid;
+}
+
+template <int N>
+std::string Nnue<N>::encodeBlob(const Weights& weights) {
+    std::vector<uint8_t> bytes(BLOB_MAGIC, BLOB_MAGIC + 4);
+    bytes.push_back(BLOB_VERSION);
+    bytes.push_back(static_cast<uint8_t>(N));
+    bytes.push_back(static_cast<uint8_t>(ACCUMULATOR_SIZE));
+    bytes.push_back(static_cast<uint8_t>(HIDDEN_SIZE));
+
+    writeValues(bytes, weights.featureWeights.data(), weights.featureWeights.size());
+    writeValues(bytes, weights.featureBias.data(), weights.featureBias.size());
+    writeValues(bytes, weights.hiddenWeights.data(), weights.hiddenWeights.size());
+    writeValues(bytes, weights.hiddenBias.data(), weights.hiddenBias.size());
+    writeValues(bytes, weights.outputWeights.data(), weights.outputWeights.size());
+    writeValues(bytes, &weights.outputBias, 1);
+    return encodeBase64(bytes);
+}
+
+// Supported sizes
+template class Nnue<15>;
+template class Nnue<20>;
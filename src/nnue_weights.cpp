@@ -0,0 +1,751 @@
+// Generated by gomoku-nnue-train (352062 positions), do not edit.
+#include "nnue.hpp"
+
+const NnueBlob NNUE_BLOBS[] = {
+    {20,
+     "R05OVQEUICAJAPb/BQAKAPr/CAAGAAkA/f8FAAIA/v8AAAkAAAD8/wUA+v/1//b/AwD7/woABAD//wgA9//0/wMAAQACAAEA"
+     "DAD//wwABAAMAAkABwD5/wkAAAD5//f/DAD5//7/AgD6//v//v/9/wIA9v/5//v/DQAEAAsADAD6/wEA+P8AAAoAAgACAPv/"
+     "CwD9//X/BwAMAPv/BAAMAAYADAAKAP///f8DAP//9//5/wsABAAIAAkACQD6/wIA/f/3//j/+v/5/wUABQD//wMABQD3/wwA"
+     "AQD8/wgAAQD1//r/9v8MAPv/CAD6//T/BQAHAPP/CAD4/wUABQAEAAEA///6//T/9v8BAPT/BgAAAPz/9P/3/wwA9v8BAAMA"
+     "BgD4//z///////T/CwADAPf/9/8BAAYACwD+//b/AAD8/wQA9//6//v/AgAAAAYADAD4/wAA/v8LAAsA+v8FAPX//f/2////"
+     "AwAMAAkACgAMAP3/+//+/wIA9f8HAAAAAAAHAPz/+v/6//v/CAAMAAsA/P/8//f//f8KAAYABwD0/wEACwD4/wEABQAJAAoA"
+     "+v8HAPb/+v/5/wEACwADAAgA//8KAAQA+P8DAPr/BwD7//X/9P/3/wsAAQAHAPX/BwABAAUACgAJAAkA9P8AAAgA9//6//v/"
+     "AwAAAPv/BQAMAAcA9f/9//r/CwAIAAAADQD8//z/9/8KAPn/9f/6/wQAAAACAAsAAAD0//j/DAAAAPn/+f8MAPn/9/8GAAIA"
+     "BQAJAAcACgD6/wgACgD1/wYA9v8CAAEA9f/3/wEA+v/2/wAA+f/1/wAA+P8GAAIADAD3/wAAAgALAPT/BwD+/wMA9v/2//3/"
+     "/f/7/wUAAwAIAPr/AwAAAAsA/v8BAP//BwAGAAAABgABAAAA9f8CAPz/BAACAAUACwAIAAUA/f8CAPT/+f8GAAoADAAAAAoA"
+     "BwAIAAsACwAFAAYA9/8DAAIA9P8EAPn/AQAJAAMA/P8HAAMA8/8CAPX/+//9/wcA+P8GAAIA9P8GAAIA+//5/wwACgDz//b/"
+     "AgD7//7/CAABAAQA9v/0/wcA///2/wUA+v/0//j/+/8MAPf//f/1//z/+v8FAAUA9f8FAP//AAAIAAYA+P8LAAEABwD///7/"
+     "AgD5/wUACAD1/wsA9f/9//f/DAADAAgA///6/wMA//8MAPb//v8EAPn/BgD0/wcABwAAAAoA9f8AAAQADAACAP/////1/woA"
+     "+f/6/wsAAgAFAA0ABAAHAAcA+//8/wUABgAFAAsABAALAAAA+/8MAPj//f8IAAAABQAHAAQAAwD6/wgABgAAAPn//P8DAPn/"
+     "CgAMAPT/AwAIAPn/CwD9//X////2/wcAAQAJAAIA9f/5/woA/f8FAPn/9v8GAPn/BgAMAAkA/v8MAAcABwD8//r/AQD9//b/"
+     "CgD5//7/BQD7//b/+P8JAPn/9/8BAPn/+P8CAP//CwACAAsAAQALAPr/BQACAP////8GAP//9v8KAAQA9v/7/wQA9v/7/woA"
+     "AwAJAPn/DAACAPj/BAD5/wwAAwANAAQACgALAAIACQD0//3/DAD1/wAA/v8LAAUAAAD+//n///8DAP7/9f8CAP//CAAJAPX/"
+     "AwABAPT/AQALAAAA/f/3//j/AAAGAP7///8JAAgAAQD0//z/CgD+/wgA9P8AAPP/CgAHAPb//P/8//z/AQD1//b/AwAMAP//"
+     "+P8DAP3/AQD0/woABgAMAAAA///3////9v/9//j/CQAAAPv/9//5//T//v/6//3/CwANAPX/BAAKAPr/CQALAP3/AwADAPb/"
+     "+f/0/wgA+P8MAAgA/v/3//b//f////n/9P8CAP3/9v8GAP3/AQD3//n/BQAEAPT/CAD9//X/CgD1//b/AQAGAAQA/f8JAAcA"
+     "AAAFAP7/+P/7//3////9//f/+P///wAA9f/3//z/CgD///r/AAAFAP7/9v8KAAcACgD1//n////9//f/9f/8/wAABgD3//v/"
+     "9//0/woA8//8//n/+//3//n/CwD0/wsAAQD5/woA///5/wYA/f/0/wgA//8FAAwACwAJAAsA+f/8//z/BgAMAAIABAD1/wQA"
+     "AgD8//T/+f8BAP7/9v/9//3/AgAKAPT/BAADAAMA9P8EAP//9v////f//P/6/wMA+/8LAPr/+/8MAPX/AAAIAAkA9v8DAAQA"
+     "BAAAAPb////9/wAA8f8BAPf//v/0//r/CgAEAAQABwAEAA0AAAALAAMACwACAAAA9f/5//z/AAD9/w4AAgD3//b/8v8EAAsA"
+     "BwD1//n/AgD+//7/+f8GAAUAAQAJAPr/+//7/wsAAwD///b/9v/4//j/+//8/wgA/v/4//T///8MAPT/9P8CAP//9//0/wUA"
+     "9f8KAA0A+f///wsA//8IAPv/AQD5/wsACwAMAP7/AgD8/wsA9f/5/wwA+//1//T/CQD0/woA/P8BAAQACAADAPX/9P8CAAgA"
+     "BgAEAAYADADz//v/DwACAPn/AwAGAPb/BwAEAAUADAAKAPP//P8BAPT/AQAHAP//9/8CAAcADAD+/woA/f8BAAcACwAIAAEA"
+     "/P8DAP//BAD7/wYAAwD8//7/BQAAAAYA9f8CAPf/AwD+/woABQAFAAoABAAHAAkAAAD1/woACQD0/wMADAAIAPz/AwAHAPT/"
+     "DAD+//j/AQAGAPT//f8LAAUAAQD+////CQAHAAoAAQAIAPj/CQADAPr/AAD4//b//v8EAAoAAgAIAPz/CQAHAAkA9f8BAAMA"
+     "9P/+/wwA9/8HAP3/BAAJAP7/BQAHAAwACAAMAAMABwAAAPj/+f8DAAgA+v/7/wAACAAAAP7/+v8MAAMAAwD6//b/AAD5/wMA"
+     "CwADAAsACgADAAwA/v/7//3/AQAKAAUAAgD//wEAAAAHAPj/BgD0//3/CAALAAQA9//6//3/CgALAP//BQD6//z/AwAAAAoA"
+     "DAD7//T/CQAFAAoABAD+//b/+//1/////v8GAAUACQAGAAcABQD6/w0A/v8CAPb/BQDz//n/AgDz/wYAAwAAAAwA9P/0/wYA"
+     "9/8MAAUABQAIAPf/9//9/woA9P8DAPz/BQD9/wQAAAD1/wQA9/8MAAEAAAD7/wIAAgAKAAAAAgD0//b/DAAGAAwABgAAAPr/"
+     "AQD2/woA+f8CAPr/9v8AAP3/+f/1//3/9v8CAP7/DAACAPf/CQAHAAIA+f/4/wQAAAD9/wQA9f8EAPP/AwD8/wsAAwD+/wUA"
+     "+//6//3/BAD5/wQABAAHAAUACgD9/wEA9P/4/wEA+v8EAP3/9v8DAPr/+f8MAP7/9//3/wEA+v/8/wcACgACAAYA+f/3/wwA"
+     "BADz////BgACAPr/BwAIAPj/AAD9/wgA+P/9/wgA9v/+/wwA+f/6/woA+P8BAPf/CAADAAMA+P8KAP3/AwAJAPz/DAD5/wgA"
+     "8/8NAP3/9v8DAAUACwAMAPv/DAD3/woA9P8JAP3/CwD7/wQADAAFAAwABwD7/wcABAD2/wAABgAIAPz/AgALAAUABAAMAP3/"
+     "AgD2////9/8CAAAA9/8CAPX/+/8HAPf/BAD4/wAA//8IAAgACAD0/wEA//8HAPn/DAAIAAMA9/8IAPj///8EAPz/+f8NAAMA"
+     "+P/3//3/BwAFAPr///8HAAAA+P8DAPv/DAD1/wwADAAAAAYAAwAAAAgACwAEAPT/BAD5//3/9P/5//b/+f///wkA/v8IAPX/"
+     "CAADAP//AwD0/wQACAAMAPf/9//7/wMA9/8JAAwA/f8IAAUA9v8GAPb/9v8AAAcADwAHAAUABwAFAPv//f/8//n/BgD+/wYA"
+     "9v8MAPf/CAAGAPr/BgABAPr/BQALAPv/BgAJAAYA9f8EAPb/AAAIAAUACQAJAAMACQAIAAMA9v/8/wgAAAACAAEA9v/6////"
+     "AQAEAAcA+P/2/woA8/8HAAIACwADAA0AAwDx/wkA9P/x//n/CQD2//z/CAAGAAYA7v/+/woAAwDs/wcAAQABAAcA+f8LAAYA"
+     "9//9/wAACwABAPn/AAACAAAA/v8NAO7/DgDv//j/AgAGAAAACQDq//v/8/8BABAAAgADAA8AEgDz//3/+f/v/wEAEQARAPv/"
+     "DgD//wcADwD9/wAA9/8MAPP/BQABAP//BgAEAAMA+P/+/wEADAAMAPD/DAD2/xIAAQAJAAEA+f8FAP7//P/8//r/AgDx/wIA"
+     "9f8IAAAA+P/w/wQAEwABAAUA9f///wEA7P/+//7//P8AAPz/BwALAAIABQD///X//v8AAPn//P8MAPf/6v8NAPf/+//5//D/"
+     "9P8DAPj/CgADAAIAAwAEAP3/9v/3/wcA9//+/xEAEAD///v/AAAEAAAAAwD1//b/+f8FAAAA//8HAP7/9P8LAAUA+P////7/"
+     "9//1/wQA9v/6//v/AwAIAPn//f8DAPb/9/8QAAoACwACAP3/+v8SAAwACAD6//7/EQABAP//9/8SAAEABAAHAAwA/v/0//P/"
+     "9//4/w4A+f/3/wcA+f/+/wEA/f8LAPf/AAD6/wEACAAQAPH/7//7/wsAAQD8//z/AwAKAAsABwD///z/CQAIAPL/BAAHAAEA"
+     "CQABAAwA9v8FAPP/+f/6/wMACwAIAAcA/v8JAAwA/P8EAAcABwAFAPv/AgABAAEA9f/4/wAADAAFAAEA+f8JAAAABwD1/wgA"
+     "BwD8//n/8//8/wcABwD8/woACQAFAPn/BwAKAPr///8GAAwA+v/4/wUA9P8HAPv/+P/1/wkA+f/2/wAA/f/3/wwA9//8/wIA"
+     "CgAAAAAA9v8CAAEACQAAAPn/+v8CAP7/AQD0//b/9f/7/wcA///6/wwA/f8HAPX/CQADAAkAAQACAP//CAAAAAEAAAAHAAgA"
+     "BQD0//X/AwD4//f/BgAHAAQA+v8EAPv/9v/0/wsABQAJAAgA+//3/wsADAD2/woA/f/6//n/9v8CAAMABQD+/wcA/v/3/wAA"
+     "/P/5/wUADAAFAPv/AwAFAAQA9v8LAAMA+P8MAPr/CgD9//b/AwD///3//P/2//j/AwD8//j/CwANAAQAAwD7/wkA9v8IAPv/"
+     "+f/0/wQADAD3/woABAAHAAkA9f/5/wUABgD//wIA9P/2//f/AQAFAAgA//////n/CQAEAPX/9v8GAAMABgADAAoA9v/7//v/"
+     "CAAJAAIA9/8GAPn/BwAHAAwA8//+/wcA+v/5/woA9f/2/wYAAQAMAPz//P////3/BwAGAPv/9v/9/wAACwDz//f/CgD4/wIA"
+     "+P/3/wwADAAEAAUACwD+//3/AwAJAP3/AAABAAgA9/8KAAUA/v8IAAIA//8BAPf/BgAAAP7/CQD+//T/AwD///r/BAAFAPn/"
+     "//8LAPz///8CAAAAAgAAAP//DAD3//3/9/8FAPn/DQACAPT/CgD7/wUA/v8HAPX/EQAGAPv/+v/5/+//CAD+/wYAEgAIAA8A"
+     "EQAJACMADQD6//T/5f/5/wwAAwDb/wcABwAIAAAA4//6//f/CQD1/xAA+/8KAPv/BgDu//3//P///yQAFwAEAAEAHAAKAP//"
+     "CAAcANv/EwAGABUA4////wkA7P8NAOn/IgDt/wMA/f8KAAQAAgDj/+H/y/8XAAQA8v8LACEAFQATAA4ABwDy/wYAGQDL/yoA"
+     "/f8OAM7//P8TAPn/KwDV/zUA8f8NAPL/CQAXAP//2P/3//X/IAAVAOj/FgAAABUACwAIAAsADgAIAAwA6v8UAAEADADF/w4A"
+     "8v8JACcA0v8EABsADgD1/xAA4f/y/9b/zP/k/+v/IwDu/xgAJQAMAPb/9/8iAPL/+P8eAPT/CAD+/wUA2f8DAA8A/v8sAPf/"
+     "DAAyAAMA/v///x8A6//u/+b/zf8GAAEA/f8RAPv//v8OAAwAEQAGAAUA+P/z/yAAAAAeAOP//f8RAOj//v/s//z/EQASAAcA"
+     "/f8JAAAA///q/+b/EgDy//3/DQDj/wMAHgAYAAYABwAJAOj/3f/8//j/AAD1/w0AAgAAACUABwAEAAkA/v8BABcA8f8FAPz/"
+     "BADr/x0AAQD3/yoA8f8SAAkABwAPAP7/7/8IANn/JAANAOD/9/8DAPb//P8eAPb/EgAHAPv/BAAVABgA+v/W/8v/+f/d//z/"
+     "7/8DAAIAGQDr//j/IwAQAPn/FADi/ycADQD///L/BQAUABUAGQDP//P/GgD6/+n/FQD+////6f/i/+X/6P8rAAIACwAhABMA"
+     "KwAHAAQA7//p/wMA3P8lAAAAIgDE/x0AIAD8/zIA6f8BAPn//f/2/xcAIgDy/9r/v//Y/yYACQDx/yMAGAARABcAGQAOAO//"
+     "AAANAMn/EwD6/wUA4P8TACUA8/8SAN3/AQD5/xQA7f8cAAYA///+/+j/7v8RAA8A8P8EAA8AEQAHAA0ACgAIAPz/+v/0/wMA"
+     "AgAMAPn/CAD4//T/DQDs//r/DwALAAAABAAIAAcA4//O/97/FwAIAPb/9f8RAP3/AgD1//r/9//3/wsA7P/3/wYAAwDw/xQA"
+     "/f/8/wIAAwAFAP//DQAEABEAAAAFAPb/8//1/wEAEAD3/wQAAwD8//f////8/wQA9v8CAAIA9/8HAPf//f8MAPb/+/8BAAgA"
+     "AAAIAPT/+f8AAPj/9//z/wwA+f8JAAYA+//2/wAABQD4/wEACwAHAP3/AgALAP/////7//X/CwALAAwABAD9//r//P8AAAUA"
+     "CQAFAPX/BgD7/woACQABAP3/CQD9/wgABQALAAoAAQAEAAwA9P8IAPz/+v8HAPX/BQAIAPf/CAAIAPj/BQD5/wwA/P8BAPr/"
+     "AQD3//r//v/1/wIACAD6//f/CgAIAPj/AgAIAAUA9P/9//b/BQAFAAUA/P8GAPX/9v8CAAgA9v/1/wYA9P8FAPj/DAADAAAA"
+     "/P/0/wAAAgD2//z/CAALAPv/DAAFAAoA+v8CAAUAAQD2//7/CAAJAAkA/f/1//b/CgADAAMAAwACAP7/AgD7/wwA9f/9//j/"
+     "9//3/wwA/v8CAPr/8/8CAAIA/P/+/wAA/P8HAPz/8/8BAAQACQD4/wYA+/8HAAIACQAFAAQACQABAP//BwACAAEACAD4//j/"
+     "8P/z/wcA/P///xYA9v8GAAgACwAGAPb/9/8VAPj/9v8HAP7/+f/w//L/+P/+/wMA7f8cAA8AHQDp/wAAFgD///H/7v/t/xYA"
+     "9v8eAPL/AwD8//n/5v/m//H/AQANAOz/AQAFAAYA2f8QAPz/3v/2/wMAGwDq/w4ACgACAA4A7f8BAAMAw/85AAoAIQDp/xsA"
+     "CQAUAPr/5f8MABwABAD4/wIAEgAIAOT/EwDq/xkACAD0/zkABwAOAAYAJgAcABQAGAAHAPb/KQD//yoAw//7//n/8/8kAN3/"
+     "JwAWAB4A7v8YAPn/DwDI/8v/+f8JAOf/AgABAA4AIQDq/wgANQAIAP//+f/A/y8A9P8CALX/8/8mAO3/AADT/x8A9/8zAOv/"
+     "AgDx/wUA0f/c/8z/FgDm/+v/IAAMAEMA9P/8/w0AAwDj/wcAGgAVAPz/EAD0/xkA/v8LADoA6/8bAAMA+P8IACQAEgAWAOX/"
+     "h//Y/wYA5f/m/zQA9/8lABwAHgAOABAABAAcANj/LQASAA0A8f/+/+f/EAAnAN3/7/8CAPD/EgDa//j/9f/C/8z/9f/9/xQA"
+     "yf8fANP/DQAQAOv/JwAYAAkA7v/w/zUA9f/5/8v/9f/v/ykADgDW/xcAAAD0/xAAGwAAADsA0f/E/9f/GQAUANj/3v/g//7/"
+     "BwA1ADMAAgAKAMr/p//a//j/EwDD/wwAIgARABEA4v/0/wIA9f/f/1IA///p//7/e//G/wIAJADk/xkA8P8KAN7/BwD9/xYA"
+     "+v8LAMv/SwACABYA5/8WAB0A/v8RAN7/BQDk/z0ABgApABIABwDN/6r/0v8fAB4A8f8bABkACQD0/wIAGQAEAPT/FQCL/x4A"
+     "BQDt/wAANwAiAOj/+f/h/z4A+/8fAOf/JADw/wIA8P/c/9P/IgAYAOv/CQD4/xUA9f8PAA0AAgADAAIA3/9GABIAJgDC/+z/"
+     "EQABABQA0//+/xQAAAD+//3/CwAAAPj/X//J/xUAFADb//D/+/83APf/+f8QAAkACADz/9b/DwAJAP7/0/8hAPr/8f8IAOL/"
+     "/f/+/wkABQAZAP7/CQDx/6n/5f8RAB0ABAALAAYAGAATAAgABQD4//z/AAD6////DgADAOT/BgAIAAEADwDv//z/DQD8/wAA"
+     "HgACAPz/7v/b//H//v8fAN3/DAABAAIAAgD7/wAA///2/wwA8f8HAAwABAACAPj/9//1//3/AwAAAAAADAALAAgA/f/4//3/"
+     "AgD6/wgA9P8KAPL/9f8BAPX/9v/0/w0ADAD2/wcACQAKAPr/AAAMAA0A9f/4//b/BAAHAAkACgAAAPz/CQAAAAIA/P8DAAkA"
+     "9v/3/wcAAwAIAPX/9P///wcABwAFAAgA+P8MAAwACQAKAAQAAAAMAPb/CgAIAAsAAAD+/wEADAD3//v/9//2/wIA9/8EAAcA"
+     "AwAHAPn//f/1//3/BQD4//T/AQD3/wMA//8GAPv//P/9/wkADAAAAAUA/v8AAAMAAgD7/wAABgD//wkA/f/1/wIACgADAAoA"
+     "CwD6/wkAAQALAPT/AAALAPX/+f8BAAMA+v8MAPz/9f/9/wIAAAAIAAUA9P///wEADAD8//3//P8IAAAAAwAEAP7/8P8EAPf/"
+     "DAANAA0ACwD7/wgA8v8IAAoA9P/x//j/+v8QAAwADAD5//X/BQD7/wAAAQAKAPj//v8KABoA/P8FAA0A8v8UABQAKgDy/w8A"
+     "DgAAAAoA5v8RAAcACAD//w8A/f/w//H/7f/u/ywAAQDu/yMAEwACAO///P/1//b/AgDv/xMAKwAaAAMA4/8bAOX/BAAtAPT/"
+     "DwAOAPP/9//8/yoACgDi/wYA5//1/wYA3v8cAAQAIQD9/wIAGgDh/5z//P8FAPr/9f/R/+T/AADQ/ywA6f8OAAkAMwD6/93/"
+     "FADz/+b/AAD1/7T/NQALABIADADu/wIADgAQABAA4/8AAA8AXf/q/+3/GQD4/y4A6/8pAB4A+v/r/+r/9/8MAD0A5v/p//H/"
+     "DAD2/wMATwDk//3/9f8ZAOz/8//z/wAA9f/+//D/HgD5/wEARAAOACkAIgA3ALv/1//8//v/JAArAPv/7f/j/53/9v83AFEA"
+     "2//n/w8A9//w/+j/BQASAP///P+J/0YACwD7/7j/4f8QACQALADc/wIAGgD9/zEArP8FAAIAp//y/+D/FQAkAP7//v8WAAgA"
+     "7P/1/wMA8/8EAPz/3f8bAAgA+P+u/y8Auf9OADQA9f8YABkA6P8ZAOv/+f///xYA8f/X//b/PQDc/9r/9P/r/wYA//8IAP7/"
+     "8/8KAO//HQANAAEA4f/o/9f/WQAlABUA7v8LAPT/+v/W/9P/EgC0/xUAAgDz/yMAwf/m/yIADAAYAOH/8v8LAPv/+//8/zIA"
+     "CgDs/xwADADr/xIARwCj/9//DAD5/ygA4/////n/lf9p//7/r/8vAP3/zf8TAPz/GQDr/wEA//8HAPD/mf8WAPj/DwCf////"
+     "QAAuAEwA+v8PAPD/8v8iAB4A9f8FAND/s//b/x8Ayv/K//v/HAAkABMABgAcAA8ABwD7/7v/AgDs//L/AAAQAAgAKwDg/wAA"
+     "CQAkAPf/DgAgAAIAFwAaAE3/sP8OABUA8f/8/wcADADD/wMA6P/x//j/CwBk//v/5/8VANr/AADi//L/PQD5/+7/BgAPABQA"
+     "0f8oAB4A6P+K/xUAAgDt//n/7f/a/wQA9/8BABAA8P8GAO3/+f/9/xAAGAD+//v/8//x//7/1/8KABcADgD5/xYACQAiAPf/"
+     "bv/e//j/CADP/wkAJwAyAAsABwD9//b/8P8DANj/KwD9/wwA4/8UAAYA8P8lANz/CwABABkA/f8WAAsAAADg/+T/3/8JAB4A"
+     "9P8HABwA/f8FAAAACAAOAAQACQAFAAcA+v8HAPD/+f/1//n/+v8EAAYA/P/x/wIACQADAPX//P/7//j/9v8PAPj///8DAPz/"
+     "BgAGAPT/9P/9/wAAAQD8//r/+P/0/wIA/v8EAP//BwAGAAUACQADAP3/BgD3//r/9/8AAAoACwAIAAYACwD4/wsA8/8HAA0A"
+     "CwAAAPf/+P/8//z/9v/1////+P/3//j/9P8IAAkACgAAAAgAAwD9//z/+f/3/w0AAAAIAAcA9P/8//f/DAAEAAsABAD5/wMA"
+     "9v8IAAYA/P8LAAoABAAEAAsA/f/3//v/BwAFAAAA9v8DAPX/+//9/woAAQABAAIABwAJAPT/BwD//wYABAAIAAEA+v/6/wMA"
+     "BgAHAPj/9P8OAPz//f8IAP///v/4/wgABQAGAAgADAD5/wAA/f8GAA0ACwAAAAoADQADAPr/AwAGAAQA+f/8/xAABAAFAAYA"
+     "BgD7//z/BAAFAPb/CAAHAPz/8/8HABEAAwAHAPr/EQArAA0ABwAEAA4AAwD8/ygAFAAYANT/GQAJAPr/EwDv//r/+f8RAPb/"
+     "BQAjAPj/2f/+//H/NQAVAPj/DQAGABsA8v8hAA0AEQAYAAIACwAjAAQACQAHAOj/8v/9/xAA5f8UABAADADn/xgAAwAMAM7/"
+     "6//T/+r/CwACAAwAFwATABMA5P8wAB4A7f9BABMAAQACAOT/EQAWADwACgAFAMz/DQDr/wsABAACAPj/9v/2/w8ABQDk/0gA"
+     "sf/n//3/FQD0//D/6P8FAAL////1//7/CgD5//L/0/8KAAYAOgDz/+f/t//p/+H/6f8JAAsA8P/4/7b/UgBXAOz/6v/d/2YA"
+     "PgDx//b/9v8CAAQAZ/8RAP3/CwCM/ygALQA5AAEAEwCy/+v/+f8qAAkA9f8WAAEAFQACAAcAUgDg/+n/8/8jAAoA+P/f//r/"
+     "CQDy/woABgAAAP7/EQD0/wUAKQARAB8A3v/w//n/HQArAP3/+v/k/8z/1P87AF4A5f/x/zIA5//w/9b/AwAAAAkA/f8HAAsA"
+     "+//1/wIAAAD0/ysACgAQ/wcA0P/8/wgA+v/8/wAA1//2/xkA7P8qANf/HABoAOH/+P8DAAYACAALAPT/4/8IAHcA/v/q//L/"
+     "/f8eACQABQDh/9L/AwDz/7T/+f8PANb/5v8g/7n/HwDT//3/WQDh/0wA5f/3//j/BgD+/7f/DgD//97/sf/M//r/RwALAOX/"
+     "AADn/wQADQCz//n/CwATAJD///8fANj/4v/7/zYAGwBzAOT/7f/1/wIABQD0/wgA+f/v/wgACADt/9f/HAARAPj/JwD2/ysA"
+     "3f8AAAUAEwBF/+b/4P8PAOT/HQAKAP3/KAD1//r/BgALANv/nv8TAPb//f8BAPT/DQArAB4Acf9DAOP/AAAsAMP/AwAWALf/"
+     "/f8gAB0ACgDx/+z/3//1//T/BgAiABAA/P8BAB0AAgAZAOr/AgASAPf/MgA3APP/IAD5/wcA9/86AAgACADj/13/vP/5/wMA"
+     "2v/4/yQAKADp//H/IQDo/wYAIAB6/zoAGAACAKv/IwAlAPb/HQDd//b/6f8QAAsA+P/7/ygABwDF/+f/7/9FAAEAGwAfACwA"
+     "CgABAPb/+//w/wAA2f8oAB4AKADM/wcABQDo/wAA3v8WAPn//P/5/wwAJwD2/+//yf/o/wwAEADp/+//GQAHAPf///8GAPb/"
+     "BgD5//f//P/2/woABgD+/wcA+/8MAAMA+v/0//b/CgAQAPz/+f/w//j/+P/3/wQAAQASAPz//v8BAPn/AwDz////AAD0/wIA"
+     "+/8HAAsAAAD2/wQABgD7/wAA/P8GAP3/AAAMAAYAAAAKAAoABAAOAPf/9P/6//v/+/8AAAMA/P8FAAIABQADAP7/AgACAPn/"
+     "+f/1/wEAAwAAAAQACQAFAAAABgAKAPj///8DAAIA+f/9//3/+v/7//z/AwAJAAoAAwD1/wYA/v8DAPf/AQD4/wcABwD2/wAA"
+     "//8FAP//CgAEAPv/CgAMAPz///8JAAEA/f8KAPr//f8AAPr/+v8KAAsA9f8KAAkA+f/3/wsABAD+/wkAAgD6////BwD6//L/"
+     "+f8FAPr/AAALAAsA9v8MAA4ADAAGAAIAFAAOAPX/+f8NAPr/+/8AAAwA+f/u//X/DgAGAA8A8P8eAPj/+P8OAP3/DgASAPH/"
+     "AgDq/wIABgAEAAgA+v///wkAIwAKAOr/CAAOAOT/EAABACgA4P8QABkACwAxAOT/+P8FAAwAEAADAOj/9v/b/+P/8//n/xkA"
+     "AwAUAPT/FwDK/x0ANwAIAPf//f/w/wAAGQAKANX/KQAVAOn/BQDi/xIA+P8TAP3/FgAPAPD/yf8IANf/IgAIABIAKAASABsA"
+     "5v8HABUACADs//H/BgAaAPT/BACd/x8AMQD7/xQA/P/7//P/HgAsAPH/AwDi//j/5P8JABMAVwDl//3/AgAqAEIA2v8AAAIA"
+     "CgBiAAoABwALAPj/CADT/zcAKwD///T/+f/4/+v/JwD2//r/LgAAAAYA9/8OAEMA0f/9//D/HgANAP3/7v/+/2n/AADs/xUA"
+     "///z//j/w/8MAAoAIAAEAAkA+//8/wEADQD//wQAdv/5/w8ANgBnANL/+v/t/0IASQD0//3/9f8EAAQA0v8HAP3/5P8EAEEA"
+     "GQBBAPj/e//a/xoA8//o/yMA/P8mABQA+/+h//T/cQDP//D//v/0/wEAOwABAAoAAwD9//b/+v/9/+n/bv/9//7/AQALAFMA"
+     "/P8bAP//EwAEAPX//v8ZAO7/7v8GAEUAxv9BAJMA+f8OAPT//v8GAAUA/v/4//n/cwD3/zEA3f8MACQAEQDn/xQA5//+//f/"
+     "7v/5/wcAGgDw/xMABgDa/9j/5/+bAAcAIgD1//H/BAACAP7/4/8HAAAA5P/l/+b/8P/4/xIA7v8BACQA9P/6/9n//P/9/wn/"
+     "x////+b/+v/G/zkA/P/5/z4A4v/z//r/CAAFAOX/BAD//+r/5P/p//7/DQAOAOL/KwD//+b/CgDF/1UAAwD5/9f/mP8dAO3/"
+     "2//9/+7/AgB9APP/8v8GAAkACQAEAPP/AgDn/0L/5v/7/93/CAAVACkA1v/u/yMADAD7/wAADgBi/wgA5/8KAOL//f8BAPr/"
+     "8//9/+z/CwAIAPr/hP8LAB8A9v/y/0EA9//K/xYA5v8OANj/DgAUABgA9//7/wIAqf/n//H/BADk/+v/9P/6/xIACQAYAP3/"
+     "AQABAND/MAD2//v/x/8rACMA2f8aAOn/MwAQAAsACwD7/wsA+f/q/5v/zP8JAA0A2P8sABgAAADu//7/IgDo//j/CgDH/x4A"
+     "FAD+/8f/GAAEAPr/DgDl/xgA6f8WAOb/MAD1/+b/1P/h/+D/IAAHAAEAKAAIAAYAEAABAP7/BQAAABAA//8PAAAA/f/u//7/"
+     "CADu/xwA9P8OAP///v8AAAcABgDx//b//v8GAAQACQD9/wAAAQAKAPf/+P8AAPr/AgDz/wkABwD5//j/+f/8/wYA//8DAP//"
+     "CgACAAcACQAMAPj/9v8HAAsA/f8DAAcA9v/9//X/CgD+/wsA9/8KAP3//P/2/woA/v8JAA0ABAAEAAQA+v8KAAkA+/8FAAEA"
+     "BAAEAAIACwAFAAwA/v/2//T//v/1/wUA+f8HAPr/DAD7/wUACAD9/wIA///7/woA8//0/wgACQD6//b/AgAJAAsA9P8DAAMA"
+     "BQD1/wcA+f/5//f/DAD3//r//v8GAPn/BQAMAAMAAwAGAP3/9/8KAPb//f8AAP//AAD5/wEA+P8LAPn//f8BAAYACQAEAP3/"
+     "+f8IAAMAAQD7//P/+v/0//7/AwABABQA/v/y//z//f8BABMA/P8DAOz/8v/7//3/DgAHAAAA9v8XAAoAAgAFAAAACwD//woA"
+     "BAD7/w4AEgAIAOr/9/8LAAAA/P/2/woA/P/4/yEA9P/3/wUA/P8DAPT/GgDv/+H/BQDi/ysAGgD7/w8A7f8JAPv/KQAxABEA"
+     "3//r//7/EwAUAOb/0f8kAAEA+/8CAOb/7P8QAAIAFgDt//P/EgDb/+D/9/8GAPP/6/8vAAwAHAAtAA8ACwDz/w8ACAD3/+3/"
+     "EADh/wQA0P8vAC4AMwD3/83/EwDS/y4A/v8QAAcAov/x/87/GwBIAPr/AQDk/wMA8P8iAPn/BAASAP3/GwAKAAAA9P+7/9v/"
+     "UQAVABEAt/8/AAwA8v8GAOT//P8KAAcACQDW/xMAVQDk/+n/7P///ygA7//1/wIADQCzAPD/DQDy/93/3/8IAEUAJAALABoA"
+     "9v8GAO7/DQAMAPr/AQATAOr/nv/p/2IA0f/l/w4A/v/9//b///8DAIX/+v8MAAEA8//+//b/3P9MACYABgDf//L/AgDz/wYA"
+     "+f/8/wAACQD6/z8AEQBxAMH/8P84ABsACgA8APj/AQAOAPX/2P/z//H/9v8xACoACgAkAM//GwDS/yAA1f8IAA0A7f8EADr/"
+     "9//J/+//NADR/xkAegAoAOv/+v/z/wgABQD///X/BgCQAC4Al//Z//H/AADw/4L/9P83AOv/9P8iAPf//f8LANb/BAASACUA"
+     "1/8mAGEAHQDv/+H/AQD///7/BQDy//z/8P8BANn/1v/w/yUAAABDADUACQDr//P/JADXAAkAIwDn/5T/DgDk/8P/7v9CAAoA"
+     "QgD0//L/BgALAP//6f8eAAUA9P8KAO7/7f8QABQA4P9HAAUACAD2/yAABAD4/w4A5f81APL/6f/U/9///f8GADcA2P/k////"
+     "CwAAAI7/BQAJAPH/IAASAAMA5/8NAOD/MwD1/+7/GgAVAPz//P+S/5H/4v/0////5P/i//b//P8HAO3/FQDs/wYA+f/7/+//"
+     "AQABAKz/NAALANL/DACt/xUARQDW/yIA4v8MAAYAFQBl/+b/LAAJAPH/7//3/wkA5P8uACgA0P8FAOb/jv/q/w4ADwDy/zEA"
+     "8//W/yIA4v/a/yAACQAgADsA+v+o/wQAk//C/xYAGQDy/xQABgADAAsA9f8WACUAAwD6/9v/CQALAO//x/8JAO7/4P8IAOj/"
+     "BgAOAAMA8v8GABMA7f/f/9H//P/8/wIA+/8RAAgAEQASAPf/CgAIAP3/AADx//r//v8AAP3/AwAAAO7/9f8BAAEADgAIAPz/"
+     "/f8FAPb//f/7/wcA9P8TAO3/+/8IABAA+/8GAPz////2/wIAAwAMAPv/9/8CAAwACgADAPn/+f/+/wIA/P8MAPT/AgD6/wUA"
+     "BAAJAAwA/P/7/wQA9v8MAPv/+f8JAAIACgD6//7/9P8CAAoA/f8MAAoA+P8EAPr///8FAAYA/P8JAAUAAgADAAMADAD7//X/"
+     "BQAMAAcA+/8EAPr/9P8AAAcACgD4/wcA+v/2////BQD3/wQA+v/9//n/CQAAAAAABgABAPX/BQAFAPb/AwAMAPz/BwD0//n/"
+     "AgACAAwA9P/0//7/BwD9/wEACAD6//v/AQABAPn///8FAP//AgD9/wEA/P/6/w4ABAABAAEA8v8KAPX/DAAIAPv/+f///wUA"
+     "/v8LAAQA/f8BAPn/+v///woABAACAAcACQDv//3/AwD3//z/CAAAAAUA8f/x//z/EAD5//j/BgAYAAAA+////+v/QAAPAP//"
+     "EwAHAPP/AgDr/wAABQAXAPj/GgALAAcABwAXAOv///8cAOT/HAAFAPn/CAAOABMAFAAQAP3/GQAIAPL/3f8WABAA7v/O/+L/"
+     "5/8sAOT/2P8KACUA3f/3//P/AADy/9H/KwDi/zYAEQDO/yoA7/8VAAIAWgAbAAoAAwD6//P/LAAGAAYA5P8kAOb/JQAdANL/"
+     "ZwAgANv/BQD+//f/CQAJAAQA6P/d/xQA0/8kAN7/+/8bACgABwADAAAA8P/s//z/7//3/9D/EwB1ABoAHwAWAPr/z//5/zcA"
+     "BgDz//b/x/8NAB8ABQAhAOP/FgDq/93/7f8gAPb/BAABAPT/AAABAP3/8f85ANr/tgDy/xQAiv84ABoA/f8oAOT/+/8BAOn/"
+     "9f/t/+b/PgDW/08A/P/s/woA+v8AAAEAAwDAAPT/7v/x/xUAdv/9/44ADQDq////1v8WAAAABgAMAPP/BAC2/wMAxv/5/w4A"
+     "3f9eAA0ADQD3/zgA7P8DAPr/9//z//f/+P8VAPX/7//4/8r/HAAhAMb/gwD0/9n////v//v/LAD1/7b/AQAPANr/ygAMAI0A"
+     "BwDy//j/AAAAAPH/0P8AAMIA4//s/zQA+//L/+7/FwDr/2cA6v/4/0YA3gDr/+j/9v8oAPT/FADc/zcABwAXAB4A8f/8/wgA"
+     "BQD//+z/6f/1//n/SQDh//b/1P/7/43/SwAgAA0ABwChAPb//f/o/+b/AwAUAAcA4f89AA4AEgDQ/+T/8/8DAAUABQDY/wMA"
+     "9v/w/3X//P/7/+v/GgD+/ysACQALABIAZwD3//P/j//2/9X/EgDg/9r/QwAQAP3/1v/l//f/AQABAPj/yf8KAPX/+f/z/xoA"
+     "AAD3/wUA/P9CAOX//P/8/x4A8P8LAEgA7f+Q/zMA5f/n/+z/2//9/8z/8/8sAAYADwAUAKD/OADZ//3/yP/i/+3/+P8VAAYA"
+     "BQDd//P/9P8AAND/7v/C/xAAGwAXAPH/t//8/9b/PQAGABcALAACAP7/+P/F/wwA/f/+//r/BADw/wEAHgDZ//T////t/wMA"
+     "5/8SAKb/1f/F//L/GQAcAMX/DAD3/yUABwAbAB4AEgDz/woAx//m//7/BgDb/woA9P/k/wUABwD///n/CQAEAB0A9//4/+P/"
+     "AgACAAAAEQDv/w0AAAAYAPn/BAD0/wAA7/8HAPP/FAAPAPz/BQD4//n//f8PAAMABAAAAPX/BwAKAPr/AgD1//f//f/6/w4A"
+     "CgD///z/DQD7/wMACQAJAPb//f8DAPz/+v////n/CAD///3/9P/4//P/+v/1/wcAAgD2/wMA/P8HAAsA+v8JAAAA/v/0//X/"
+     "/P8GAAMAAwACAAsA9//z//T/BgD+////+v/4//j/+//+//z/AQD9/wYA9P8LAAUACAAIAPX/BwANAPT/+v8LAP//+f8CAPn/"
+     "CgD6/wkABwD7/////P8DAPj///8FAAEACwALAP7/BwABAAsAAwAKAAkA+//4//v/9v/4/wsA9v8AAPj/CgAHAAkA+f/6/wQA"
+     "BQD3/wcA//8KAAoA+//9//b/+P8JAAQACwD+/woACAD6//7/BQAHAPz/BQABAAkADQAJAAcAAgD1/wsA+P8SAA4ABwDy/wAA"
+     "DgACAAYA+v8AAO3//P/5//7//f/1//X/BQD8//n/AgAJAA0A9/8OAPD/9/8TAP//8v8bAPv/FQAQABEA3f8LAAcABwDu/+T/"
+     "BgAMAAwA9f/z/wEAEwDe/zAA6P8cAPr/+f85APT/GQAnABUA9P/c/xcAAgACADUAIADy//b/BgDz/wAABwAFAEUA/P/c/w0A"
+     "DAD+/yUAz/8CAOz/AQAQAPf/7v/o//n/JAARAAYADgD+/wAA9v8jAP//EQDA/wsAQADu/zIAr/8TABIAxP8PAB0Az/8GAOX/"
+     "+v8AAAYAHQDX//f/+P8bAC8AVAD5/wL/DwDz/wMA8v/x/xgA4//8/2gA2/8cABIAAAAMAMD/CQDs/+r/CwCX//z/O//U/yQA"
+     "6P/s//T/0v8hAFkA8/9v/wQA/v8EAAQAAQAOAIT/4v+uACUAFQDw/97/CAD2//z//f/y/wMAMQD8/x0AFADt/9H/1v8CAOz/"
+     "8/8aAPT/hv8HAPT/9f8AAPH/WAAYANP/WADd//7/KAD4/ysAGwAxANv/7v8EAO3/8P/v//D/KwDQ/yEA5/8FAPv/NwDu/8P/"
+     "BwDGAOz/9f/7/+T///8dABEArf/1/wP/7/9tAAIA9P/+//wA7P/i//n/JAD7////yv8JAAYANgAPAPj/9v8a/yX/8//4//L/"
+     "lwD0/xAADQD2/+D/2/8cAAQAPwAqAOD/RQDz//f/wv/p/wT//v/w/8//+f/1/1sA7P/j//L/5f8CAO3/1v////f/+P+A/6kA"
+     "8f/d/wMADwAGADEABwDz/1sA8P/n/z4A/v/1//L/GQDN//L/8/8KAOP/7P/4/2n////5/+7//P/9//z/FABUAAcAwf8BADsA"
+     "MQAGAPX/AwBIAPX/+v/e/+f/9/9UAP3/yf/+/w0A+f/d/9z/8v88/wkABAD8//z/8v/0//H/LAD8/9j/DABY/yoACQDN/ysA"
+     "GAD1////1f/8/xQALQDn/9D/+/8aAPX/6/8IAOT/Df8OAAEA+P8cAP7/+f/d/woA7/8LADAA/P8dAO3/xf8wAPD/9P8sANz/"
+     "y/+6/w0A6v/s/wYA9P/3/wMAHwDw//P/AwAcAKP/IAACAA4A1v8NAOD/BgAnAPj/MQAXABsAEgDQ//H/+//t/9X/5/8PAAIA"
+     "+//4/+H/IAD+/w4ADgDx//r/CgDe/yAAEQD9/+z/+/8RAPn/AADv/wEA8/8LAPX/HgARAAoA0//z/+D//P8JAO3//P8AABQA"
+     "+f8MAPj/BQAFAAsA+P/0/wEAEAD5/wkABwD4/wkA+/8DAPD/8//1/wgACAABAPb//v8BAAYABAD7/wAA/f8LAPb/BwALAAgA"
+     "AwD9//j/CAAKAAUADAD5/wkA/f8LAAUABwALAPn/+f////T/8v8BAPb/CQD6/wcABQABAP//AgACAAwA9/8CAAkA9v8AAAUA"
+     "/f8BAAMACwAAAAoA/v8HAAkA//8DAAQA9f8HAP3/+v/5/wcABQAGAPj/9v8AAPT/+//6/wcABQD3//j/CwD3/wIACwAGAPT/"
+     "9////w0ABAAJAP3/9/8MAPj//v/6//z/BAAMAPP/+v8EAPX//f/5//X//v///w8A9//6//7/+/8BAAwA9f/6//b/CgALAAcA"
+     "AwACAPr//P/3//3//v/3/wAABwD7/wEADgANAPX/AgANAAEA///3////BgD//wIA/f/9//z/AwDy//b/+v8FAP//CQD3//z/"
+     "/v/+//T/CAAGAAQA///9/wAABwAJAPr/BwAQAAUA5v/t//z/AwAmAPn//f/J//3/BAD//xgA2v8OAAgA/v/6/xEAIQDx/9//"
+     "6//u/+z//P/+/xQAGAAGAAAAGAAcAAEADwAJAO//7//w/9f/9f8AABsAIQAUANz/DQD8/w8AAAABAAMA2//w//r/0/8AAPr/"
+     "8/8TABQABwDh/1UAHQD///v//v/+/x0A9f88AJ3/FQAXACQAOAAgADYAGwAAADEA7f/5/xAAzP8JAPb/sP8GAOX/8//s/9b/"
+     "agAyAN//CAAFAP7/9/8QAPX/SwAZAPr/PwA0ABkAxv/n//7/0v8MAPT/8/8HABUA+//z/ysA5//x/9//9P8OAFkAQADx/wIA"
+     "BAD0//P/DAD+/6kABAD+//H/0f8SAPb/9f81AOr/NwDr//H/BABs/yQA+//0/w0A0v8eAPb/+v8OABYAAgAHAP7/9v/v/wMA"
+     "8f9+AAoAHwBDABgAFADG/83/AwBBACAA9//iAA8AAwD0/4f/HwDz/8n/4//q//j/GgBdAPn/AwAJAPr/+f8CAPb/HQAl//P/"
+     "EQDs/+//MQATACcAkQASAB0A7f/8/wAA/f8LAPX/BgDO/9L/+P9HAOj/4v/u/wMACAC1AP3/CABrABgAIQCiAAgA8f8CAOD/"
+     "zf8kAGEACgAmAPP/8P8kAAIAAgAGAPf/y//f/+7/EQDn/+T/AQAAAO7/9f8AAPT/9//s//n/aAD9/+b/AgDs/xgAAgAqAAoA"
+     "FgD4/+P/Yf/8/w8ASQD0/8z/7//8/y8AGgD3/+z/BQAJAPv/3P8NAPn/9f/6/1AACQDc/wAAjP/N/y8A8////x0A9v/R/yoA"
+     "+f+Y/zIA+P/S/+//9//6/+b//f/1/wMAAAD3/w0ABQAYAPv/tP/q/w8A/v8DACcAIADp/8//8v8gAP7/X//z/83/sv9hAPH/"
+     "5f/x/+b/AAD3//j//f/e/wAA+v9o/z4A+v/5/+T/8P/t/93/+P/H/ycAKAAFAEAA6////3j//f/m/w0ACwAEAOr/4f/j//j/"
+     "4P///z8A7//5/x0A7/8EAPL/8//O/wkAFQDj//7/7f8rAAQAFQABACsACQCa/7//fv/U//H/DADZ/wwAFAAFAPf/6f8KAPH/"
+     "+//8/8j/+/8HAPr/9f8RAPr/DQAGAOX/CQANAO7//P8IAB8A5v/o/wgA3P8FAOz/6f8JAA8AFgD4////CgAEAAwABwD2//z/"
+     "+/8FAAEA8v8LAPv/8v/9/wEAGgDz/wwA+v/+/wYADgD2//v////9//3/CgD4//X/BQAKAPn/AAAAAPn/DAD3/wEA9v8BAAgA"
+     "AwAEAPT/DQAIAAcA///4//T/BgD4//X/+//3/wkAAAALAPT/+f/0/wAA9f8IAA0ABAALAAMACwD9/wwABgD3/wgABgAEAP//"
+     "CQANAPb/CQAEAAYA+P8AAPr//v8BAAsAAgALAPX//P/9/wsA+//+/wkA9/8KAPr//f/3//j/9f////b/BQD+/wsAAgD1//b/"
+     "+P8HAPr/9v8EAPr/BAAFAPf/AQALAPf/CgD8//z/CgD9/wMA/v/9/wcABgABAAMA+f/z//j/AwAIAAQACwABAAoA+/8HAP3/"
+     "9v8MAAoABgD6/wgA/f/1////DgAJAP3//f8ZAPP/+//4//7/+f/7/wkABwABAPH/FQDy//n/+v8HAPX/AwD0//j/8/////3/"
+     "8f/8/wkAAgAeAC8AEQALAPf/AADu/wkACgD//8f/DgAOAAgAIAAHAAsAFgATAPP/AgAEAPX/2P8KANX/7P8lAP7/GgAKABMA"
+     "GQAXADEA+//z/wIA4f8fABcA1v/H/woACAD4/xcA3f/l/wcAKQD5/yIACAAJAMz/DADX/wIAJwDu/xYAIAAEAPb/QQD8/wEA"
+     "DQAUANj/HQDw//j/GgDx/ygAPgAnAAkAIAD7/+n/LQD6/wsA9P+0//L/xP/8/97/4v/h/yYAGABoACcA+f8HAAAABwAYABsA"
+     "/f9lAKT////7/wgAHwDA/wQAEgAFAAIA8P/+/w4AAQDy/wsA9//9/+z/JgDs/wUAVwAYAPf/BQAIAAAACQAOAP7/XADo//b/"
+     "/P/7/xsAGwAOAPX///8UAPb/1QAPABgACwCi/yUA/v/W//z//v///3wAMwD5/woAAgD///n/AgD6/3wA7P/V/+L/9v8OANv/"
+     "TwAmAGQAGwALAOv/FAAXACQAQQD//wEA4P/s/+z/1//t/z8A+P/5/wYA///8/wQA8v8PAB8AEQACAB8ADgD4/8D/GQCdAAsA"
+     "AgD3/+7/jP/5/87/JwD5/93/5v/0/yMA6P8JAAIABwACAPv/CwAIAHwA8f+p/zgADwDt/+P/ov84AAEAfwAcANX/+//5//j/"
+     "AwD3/0sABQDG//7/7/8MAAoA7f/8//v/BgCrAOT/BAD0/+r/+P9NAAEADQAOABwAEwAjAPz/GQD6//z/4P8cAPL/kf83AP3/"
+     "3//5//b/8v8WAP7/+P8KAHT/+v/r/xIACADx/+j/+f8DABEA7v/0/y8A/P/4//v//P/8/+3/EwD6/w0AVQDu/9n////3//D/"
+     "NAD2//j/AAD9//7/i/8WAP//CgAWAEMA7P/6//r/BwD9/+T/8P/5/wQA8/9S/4P/CgDq/yEA+//t/xAA3v/1/+v/7P/6//H/"
+     "DwD8//f/EAAcAAgAnf8QAO7/5v/6/8X/QAD+//b/MAAZAP7/pP/z/2n/+v9CAAIA2//s/xwA8P8EACEAEQDQ//z/6/+y/yEA"
+     "/f8VAM7/LQApANz/IgDd/wMADAAXAP3/JgD1/+P/yP/6/8P/AgD//+7/8P8fACIA/P/0/yIABgDz//n/yP8CAA8A9v/k/xYA"
+     "AADz/woA3/8HABsADAD8/xwAAgDW/9z/zP/w//n/FQDo/xkADwASABEA+P/3/wcA/v8UAPT/AAAMAAMA7P8FAAkA9v8LAOv/"
+     "AADv//b//f8DAAAA7v/4//n/+v8FABAA8/8NAA0A+/8HAP//BAD+//3/9v/1////AAALAP3//P8KAPr/9v/3//b/9v8KAAkA"
+     "+f8NAP3//P/7//7/CAD+/wQA+v8IAAQA9v8EAAAAAQAGAP7/9//3//v/CgALAPX/BgANAAMA+f/9//j/9f8AAPj////0//T/"
+     "/v8CAAAACQD9//r//f8NAPb/AwAKAPn/BQD2//X/+P8DAPT/AAABAAMADAD8/wEABQD5//v/9/8NAP3//v////n/BwD9//z/"
+     "CQD6//z/CQAFAAkACAD//wQABAD0/wMA+f/0/wQADQD8//z////3/wsAAwAMAAkA9f8MAAEA8/8MAAoA//8MAAkADAAMAAQA"
+     "BwD6//z/AwD9/w4A+P/+//b/EwD6//n/CQDy/wIA+v/9/wAA/P8DAAoACwD3//7/8v////v/BAD2/wcAAQDz/yQACQD8/wMA"
+     "8f8IAPD/LQD9/wQA2f8TAPb///8EAPX/MAD9/wMA8f8DACwA6P/e/+3/2f8tACIA8f8BABEACQAYAAkAHwDy/+//+P8FABAA"
+     "EQD3/77/FQALAAUAEwDj/yAAAgAUAA8AEwATAAsA3f8wANr/JQD9/xUAAAAJAAQAIwBCAP//AwD//wkA+v8nAAUAJQDx/wcA"
+     "y/8WAND/6P/v/wUAAQD//xQA/P/o/w8A8P+6//7/+P/s/wEAAADz/zYAIQAEAPP/BwD+//b/+//0/1gA5//0//f/BgAZAA0A"
+     "JwDR/+//BwANAEsADADh/w4ADAAeAAEA5//1////8v92ACwA8P8HAAcAAQAXAB4A7v9EABgA5P/7//P/EgC1/zIADwA2AAkA"
+     "/v/z/wsA6P/8/wAA5f8CAPb/6v/r//X/QQDq//j/9f8HAPr/FQASAAUARACy/xQA/v/Z/xMA7f8SAAIAUwABAO//8v/8/6T/"
+     "AgDf/wgA/P/y//b//v/0/ykAUQD9/wQAAgD8//T/9//9/xIA4v8uAMz/CwDv/wQAGAAMAFMAGgD1/+j/+/85APb/of84APr/"
+     "6//3/+3/y/8GACIABwAAAAwA+f/+/wcA7f/3/8v/TQAOAOX/3/8KAPP//f9fACMAyv/u/+7/1v8HAB0AUwDx/97/CwAHAOH/"
+     "8f8YAOD/BwAAAPz/DgAJAP7/BAArANv/8f8WAPb/vf9ZAO3/LgAuAMT//f95/+3/BgDR/0kA/P/r/wMADgAJACkA+//o////"
+     "CwBpAPn/FAD8/wQAsf8DAPP/GAD5/wAAGwDM//7/AwAGAPz/1v+7/w0A3v8qAPT/2f///+3/DAADABIA5f/p/zb/+v/v/xUA"
+     "9f/9/+f/8/8IAAAA6P/n/zEA8v/x//H/7/8IAO3/NQABAOj/RADf/+r/AAD//8r/FwAOACIABgADAB4Afv/W/+X/DwDq/yUA"
+     "7f/d/xsA8v8TAB8AFAAxABUA8/9p/8f/EgAoAAEA8P/p//3/HgASAPj/HwACAO3/BAAWAPD/KAD3/xsADADh/wsA4P8RANn/"
+     "DgAbAPX/+v/3////x//o/7H/5f8BAP3/HAASABUAFwD8/wwAEgACAPH/EwC2/xAAIgAfAM3/DQAIAPX/AQDd/yAA6f8XAPX/"
+     "GAAWAN3/6P/u/+3/AQAJAO7/+/8YABMAAwABAP//+/8GAAkA6v8BAAQA9//9//T/CAAEAA8AAAACAAsA+f/z/xIA9f/8//3/"
+     "BgAMAPT/+//5/wwAAQD+//f/DQAAAPr/CAD2/wYABQD2//T/BAAJAPf/CgALAP7/CAAMAPn/BAAIAP3/+f8AAAMA8//9/wMA"
+     "CgAAAAoABgD///n//v8LAP7/9/8EAPT/AAD9/wQA9//3/wAABwD0//r//f////z/BwACAAgA///0//z/CAAIAAwAAwAGAPf/"
+     "CwD5//7/9f/+//n//v8HAAYAAgD7/wgA+/8FAAUAAAD0/wgAAQACAAkA+v8EAAoA9f8MAAgA/v/8/wcAAgADAPX/9P/7/wEA"
+     "+f/2//n/AAADAAYADAD4/wEADAD4//P//P/4/wUABwD0//7/AgD5//n/AAD2//r/CwD4//v/CQAPAPn/CAALAP3/7v/1////"
+     "+/8GAPz/BQAIAPn/BgAKAAkA//8IAPr/+f8AAAEAAwAFAPn/DgAHAPz/BwD+////GQD8/xEA9//7/x8A5/8PABgAFwDz/w0A"
+     "BAD8/wgA0v8LAO//DQDv/xcACgD2/+n/8P/l/xIAJgDn//n/CgD6/woAKwAQAPT/AAARAP3//f8eAAkA5v8HAA8AFQAJAMz/"
+     "+/8dAPz/8f8LAAcA9P/j/wkAz/8MAPr/FAABAP3/RQDl/x0AOQANAPD/2f8JACYADAAbANL/AwD5/yYACQD4/yYAKgC//wsA"
+     "DQAhAAYA5//i/wcA/P////L/9//Y/xIACQA2ACYAAwD7/w8ACQAWAPP/DwD8/wwALgD+//7/AgAnAC8AIgAJADMA/v8KANf/"
+     "CwCx/+P/CwDZ////9/8YAND/6v8EAOr/AwAwAPH/XgD7/xwAl/88ABwA9f8rAOn/PAD+/x4ADwAVAAoAAQATAPz/6f/i//T/"
+     "9P/r//T/9v8NABYA4f/e/wUAAQARAA8A+P9GAPb/GQAEAAUAEAAXAHUAQAAlAEIAsv/7/wwAJAD7/9n/KwDl//r/8P/2/wUA"
+     "AQA1ABgA7f/+/wcA+P8YAAgA+//r//L/yv8MAP//vf/8/+j/EAD+/wEA0//V/7b//P/+/0YAAwCm/wIA7/9BAP//MwAcAAcA"
+     "DAARAAYAEwD7/wwAt/8JAO//9v8DAOT/OQD9/w0AGwDh//z/KgDV//f/yP8MAOv/1P/+/w8A8f8NACkADAD4/xAACgAUACYA"
+     "AwDf/47////z/wQA3v/z/wYARwANACkAIAAGAGT/IwAXAAgAMwDt/+7////r//T/+v8+AOH/8f8KAO//9/81APz/5f8FAPX/"
+     "HQD//wsABABZABcAIAAjAAwAAwCY/+D/6//7/ysA6f/0/+T/+f8VAAIA9/8ZAN//CgAfAB0ALAAKAPL/7v8yAA8AGwAgAOb/"
+     "OwAfAOz//f/x/wAAlf/Z//D/GAAgAOT/y//+/woAGAAHAAcAKgASAAL//P8aAPz/+v/6/+z//f8IABIA7v8CAPn/GwAAAOb/"
+     "3f/5/6D/GgAKALX/6/8hAOz/AQDt/14AEQD7/xIA5v8PAAoAwf8SACYAAwDk/ywADADc/woA3f8ZAAUA+/8aADkAEABm/+n/"
+     "/f/m/wIAFQD+//n/AAARABkACQALAO3/+f8ZANz/FAAMAA0A4/8JABsA8f8WAPH/KwD//xEA+f8oAAEA8//m/9v/1v8GACMA"
+     "5/8bABgABwAIAPf/BAD2//3/9//5/wsA9f///wAABgALAAQA9v8DAAYADgAJAAEA9P/7/wcACQAIAAQABQD2//b/9v/y/w0A"
+     "+/8MAAEA9f/v//3/BgALAPb//v/3/woA/P8CAPr/AwAIAPX/CAAHAAEA/f/6/woAAQD///7/+v8CAAYA9v/1/wgABwALAAwA"
+     "/P/2//v/BAAEAAsA9f/5//n/BwAFAPf/CwAHAAIACgD1/wsABAABAAQADAALAPr/DQD9/wYA/v/4////CgD///b/AQAAAAcA"
+     "9//2/woA9f/9//T/+v8LAAoA+v////3/+v8IAP3/BQAGAP//CAAKAPb/BwABAAwACgAFAPf/BAD8//X/+f8IAAAABAALAPT/"
+     "+//4/wsACQD9/wAABAD3/wYA9P/+//f/AgAKAPX/+//2//r//P/1/wIA9f/0/wgA/P8JAAUA//8KAPv/+P8GAAYABwAGAAEA"
+     "AAD1//r/AAAGAPj/+f/0//f/CwD///7/BQAKAAgABwATABYAHQD1/+///v8DAPj//P/3/+X/BgAAAAsADQD2/xQABQAGAP//"
+     "/P/6/+z/6f8HAPn/DwALAAYA/v8MAAIA5v/d//3/CgAMABkADAD+/wQA9v/q/wwAAgD5/wEA+P/p/wMA8v8EAP//DQD+/9v/"
+     "AgDk/////v8TABQA+/8gAPv/DwAEAA0AAAANAAEA/P/2//X/3/8bAAQA9/8dANz/DAAHAPz/+P8JAAEADADj/x4A4v/8/wkA"
+     "AQAPAOf/GgDt/wgABQAHAA8A3f8JAAUAFwAEAAoAKQAmAAkAFQDr//L/HAAHAAQAEAAXACYA+v8kANT/6P8zAPf/DQACAB4A"
+     "BwApADgAFgAHAPb/CgD+//r/2f/y/xMADQD6/zMA4P8AAAUAAQArACIAAgDs/9b/5f/i/y0A/v/3/ycAHgD6/+T/BgAvABEA"
+     "FgAfAO7/+P8MAMb/0v8cACgA9f8XANL/8/8DABAAFgAlAPz/eP/Y/xsA3P8XAOf/7P8SAOX/DwBNAB0A8/8XAPP/CwAaACgA"
+     "8f/x/7j/DAD//+b/HAAWACAAAADv/xsAyf/+/5L/4f/3/9z/CAD9/9//CwDz/0UA+//4/wYACgD+/wMAKQAqAB8A1v/j/yUA"
+     "2f8tADYAy/8TAAgA3f/7/y0ADgD0//L/IQDd/xAA7f/w/wUA+P82AAoAMgAMABAA6f8MAPr/BwADAPb/7/8vABkAFwAtAOf/"
+     "NgAEAPT/HgA6AAAAcP/L/9n/2P/e/wcA+f/x/wQA/f/t/yEANQD//////v/q/x8AEAAYAMj/IQD9//7/HQDW/+//CAAFAAYA"
+     "PQAGAJ//5P8LAOH//P/w/+v/FwAKAAUAAQDx/yUADQARAOv/7v88AAwA+v/G/97/GQDx/yEA9f8NABQABAADADMAAwCY//f/"
+     "BADM/+n/BAABAAcACgAPAAoA/v8OAPj/AgABAAIAKwAUAAYAAwAVAAwA/P8MAO3/EQAqAAcAEwAUABYAfP/g/wkA8v/3/xIA"
+     "4/8SAOv/+f8EABcADwDu//P/AADr//7/FAAUAO7/+/8BAOX/BgDs/wQABADz//r/FQANAMv//P/3//r/9v/z//z/DgAIABYA"
+     "AQAKAPr/9v/8/xYA1//4/wAADgD2/xMACAD6/wgA2/8EAAsACAAGAAkA+//P//L/8v/7/wYADwD3//n/AQAFAAsA9v/9/wgA"
+     "CgALAAEACwAIAAgABAAAAPb/CAACAPr/AgD4//P/BAD5/wMA+/8HAAMA/v8GAAkA9//0//z/9f////P/BwD6//r/CAD7/wkA"
+     "+/8GAP3/AQD8/wkABQAIAPr/BQD3//z/BAAIAAYACwAKAAEA+v8CAPf/AgAAAPX/9P8FAPP/CgAFAP//BAD4/wkACgANAPb/"
+     "+P//////AQAHAAUACgAEAAsA+v8GAAcABgD9/wsA/f8HAAUAAQAHAAkA+P/2/wUACwAHAAcAAgABAPj/AgAMAPf/AgDz/wQA"
+     "9f8FAAkAAAAJAAMA+f///wgACgAFAPv/9v/6//j///8GAAwADAD7/wkACwD0//3////8/wAA/f/+/wcADAD9/wsA9f8JAPn/"
+     "CAAIAPj/BwD8//T/CgD6/woA8/8FAPf//P////T/+//7//3/CwANAPn/CAAJAAMAAwD2/wYA//8NAAkABgAEAAYACwABAPP/"
+     "BgABAAEA9/8EAAwA/v/0/w0AAgADAAgA+f/7//r/FQD0////6/8IAA8A8/8IAP7/+v8HAP7/+P8CAPv/AwABAP7/BQALABQA"
+     "+////w8A/f8SAAQA///6//b/AAAFAPz/CQAFAPf/CQAVAAYACwD5/wAA+v8KAPX//P/8//f/4//2/wIAAAAPAO7/CwALAAQA"
+     "BgAKAA8A7v/v/w4A8f/6//3/+//l/w4AFwDx/ycA2f8hAPr/+v/9/wsABwD//93/6//R/xcACgDo/woADQAIABcA/P8TAP3/"
+     "8/8RAP3/LAAGAAMA3f8PABwA+P8OAOn/KQD+//H/BgATACMA7v/u/wAA4P8BABUAAAAGAAMABwAOAEAA//8UAAgA/v8RAA0A"
+     "BQADAOj/LQAEAPP/AAALAOb/HQATAPv/JAAJAPD/4/8FAND/MQACAAcA/f/2/xAACAAWABwA6v/0//b/9v8OABcAEADg/wYA"
+     "DgDn/wUA2/8YACwA+v8DABMADwD5/9j/+P/y/x0A9v/1/wIA6f8JAAgA+P8QAAQADwDt/xoABAAAABQA+v8EAA0AAQDt/9//"
+     "BwATAPb/AwAHAP3/8v/x/xQA/P8IAA8A/v8CAAIADwAQAB4ADwAGAAgAQgANAA4ACQD9/+f/AwAMAPT/JQAMACQABQD9/wIA"
+     "CgAYAAEA0f8BAN3/8/8mAAAABAAUABUA8P/9/////v/6/+n/AADt//n/9f/d/yMAIwD//wUA6f8BABAABwABAPv/BgDb/9z/"
+     "DgDd//3/+//8/xIA+v8ZAAMACQADAPz/9f8VAAEABQAZAAkA1P8gAB4A7v///+v///8cABcABQAgAOv/0//o/wMA9/8DABUA"
+     "CQAJAO//HgANAA8AAADt/+T/GwDS/wgA+v8cAMT/FgAGAPj/IQDv/xwADAANAAUAJwAOAOT/1f/t/97/EgAbAPb/8f8IAA8A"
+     "CwAjAAUAAwACABkA4/8kABQAFwDu/xIACAD3/wYA3f8SAPL/GQAKAA8ADQDk//D/4//X/wgAKADr/xIAEgD3//j/CQAKAPv/"
+     "/f8PAPv/FAAHAAQA5/8WAAQA7v8NAPn/AAARAPL/BAAbAAYAzP/2/wAA+P/8/wcA+v8HAPz/AwD5/wkA9f8DAAUA+P////j/"
+     "AwAFAO3/DwABAAgABwD7/wMABgAFAAMA+v8KAPz//P8HAPX//v8BAPD/AgAAAAMABAD7/wsA9v8HAAUA/f/7/woA9f/1//v/"
+     "9f/2/wYABgAMAAQAAwD6//v/CAAHAPn/AgAHAPX/AAAGAAQA8/8GAPr/AQD4//n/9/8FAAkA/P/6/wIA9/////X/9P/8//X/"
+     "BwAAAPT/AwAJAPz/AQD8/wwA9f/5/wwAAQAHAAoA9P8LAAQA+f8JAAAA+v/6//r/BgD3//f/AgD6/woA/////wkAAgD2//T/"
+     "/P/2/wIA9v8JAAAAAQD3//v/CgAIAAEAAwD+//T//P8JAPX/DAAAAAMA9f8JAPX/9v/3//n/9f8LAAEAAwAEAP3/AgD0/wsA"
+     "CwD0//T//P/3/wEACwAJAAcABQAAAP7//f/1/wEA+/8BAAYABQALAPz/+f8AAAMACAABAPr/+//1/wgACAD///f/CQADAPj/"
+     "/f8BAP3/CQALAP//+f/6/woACwD+//b/BAAMAPz/BgAKAPj///8HAPz/CQD1/wYABwD///3/CQAGAPT/BgAMAAEACgD4/wcA"
+     "///9//7/+v8DAAcA/P8CAAoADgDy/wMA//8BAAYA9v8EAAQACwD6//j/9//3/wMA+//+/wIABwABAAsACAD0//v/DAAEAAsA"
+     "+v/0//3//v/8//n/DQAKAPn/BAABAAIAAgD8/wYAAQD2//X/BAAAAPP/BgAIAAMA9f8MAP7/AQAAAAcABQD7//z/8v8JAAIA"
+     "CgAEAAUA+/8DAPb//f////r//v/7//b//f/0/wUABQD9//r//P/7/wsA+/8JAAYADwAHAAYA+/8AAA0ABwABAAEACQACAAwA"
+     "+v8EAAcA//8EAAQAEgAHAAgACgDy/wQAAAD8/xEABgANAPz//P///xcA/P8GAPb/+f/+//P/9f8QAAEA+/8QAAEABQAbAPj/"
+     "BwAGAAEA9//+//3/6//0/wMA9P8PAP//CgAAABIAEAD2/wgA9//z//f/9P8KAPb//P8EAPz/+v/t//n/FAAAAPv/BwAAAAQA"
+     "AQAIAAMA+//5//r/AgD2//7/CQAKAPz/+/8GAP7/AQAAAAYA+P8OABAAEAAJAAIABgADAAsAAQDx/+n/+v8DAAoA/f/x//3/"
+     "/P/7//v/BgAIAAEABgD+//3//v/7/wEA+v8GAPL/DAAJAAQACAD//wIA/v/5//T/EAD5/wgA9/8GAAIA9P8FAAEA7v8HAPn/"
+     "AwAKAPr/DwAHAP7/BwD8//r/+P/0//r//P/1//H//f8PAPf/9f8KAO//BgD5/wQA/f8PAPT/AgAFAPT/9v8LAAYA+//1/wIA"
+     "DwAFAPr/BAD+//3/6v8IAAsAAwD1/wwABgAJAAEA/f8dAOf/EAAQAAUAAQADAPz/BgD1//z/AgD+//z//P8GAP7/AgD4//P/"
+     "9v8DAPj/9P/2//3//f8LAPn/CQANAAUABgD4/xQA9//4//f/9f/5//3/+P/6//z/CAD7/wsA+/8JAP7///8EAA0ABwD8//j/"
+     "CAACAAgABAD8/wYADgAFAAcAAAD4//3/8/8BAPf/+P/7/wgABgABAPX/9f/5/woAAgD4//3/CQD6//X/9f/+//j/CQANAAAA"
+     "8v8MAAAA+v/5////BwAJAAgA/f8FAPX/9/8JAPz//v/7/wQA+f8MAPv/CwD7//b/AgD9//z/CgD7/wsA9f8BAPf/CwAEAAUA"
+     "9//6/wAA9f8MAAUADQACAPr//v/+/wEA9P/8/wIAAwD4//3/9P///wYA+P/5//7/CQABAPX/DQAJAPj/BQD//wwABwACAAQA"
+     "CwAAAPr/AgAAAAQAAAAMAPz///8JAPv/9v8IAAEA9P8GAAMACQAJAPf/+P/0/wMABQD///b//P/4//n//f/7//j/AAAAAP3/"
+     "CQD3//b/+/8GAAEACQD9/woA/P8AAAgADAD4/wAAAQD2//f/9f8HAPv/BQAHAAoA+/8HAPX/9/8GAPX//v8MAAIA9f8MAPX/"
+     "BgD7//r////+/wkACwD7////+P8BAAgAAQAHAPz/9f/4/wgABAAMAAEACgD7/woA9v8DAP3/+P/8//X/9f8GAPz/9f/z//X/"
+     "BwD6//b/DAD8/wsAAAD0//z/CgALAPn/9P/9/wIACAD+//r/CgALAPz/BQD5/wAA/v/8//T/BQD5/wkACgACAAsA9//2/wkA"
+     "///1/wgA+P/1//f/9v8DAPn/+/8CAP7/+P/6/wkABQD8/wgA/v8IAPT/AwD4/wsABwACAPT//P8CAAEAAQAHAP//9////wQA"
+     "AQDz/wYA9//3/wAAAwABAPb/9/8DAAkACQD4//7/+f////3/CwAMAAgA9P/3//j/+P/+/wAA/P8GAP7/+f/5/wQABwANAAwA"
+     "AwAMAPn//v8KAPb/BAAIAAIA+P/6/wgAAQALAPj//f/9/wwAAQAJAAcA/v8LAPv//P/4//j/BwAKAAoA/f8DAAkACQABAPv/"
+     "/v/8/wgACgD8/wMA+f/0//T//v/7//7/+/8DAP3//f8LAAMACAAHAAQA/f/1/wcABAAIAP7//P8NAPv//v/8/wMACAD/////"
+     "CAD5/wcACgD+/wYACQAIAAQA9f/7/wIABQD3//T/+P/8//n/9P/8/wAABgD9//j//v/0//3/CAD7//7/+P8HAAcAAgAFAAMA"
+     "+//4//7/CgAIAPz/BAACAPX//P8AAAgA/P8GAPT/8/8KAAgACAADAPX/+P8DAPv//f/8/woADAD2//7/BAD+/wgADQD5/wUA"
+     "9v8AAAoAAQAHAAQA/P8GAP///v/6/woA//8HAAYACQAKAAsA+v/9//z/DQD6/wIACgAAAPr/DgAEAP//BwAOAAAA/P8IAPr/"
+     "AwACAAoA9f8GAAYA9P/x//b/+/8MAP7/9f8LAPb/+f8EAPn/CAAEAAsABgAHAP//BwADAPb/AAACAP3/9//4/wUADQD9//f/"
+     "+/8DAAAABwD3//v/+f8KAAQABgD8/wMA+/8HAAkAAgAJAAsAAQAKAPX/8//2////+v8CAP7/AwABAPP/9v/5//v/CQD5/wAA"
+     "BgAGAPT/CAANAPr/CgD1//j/CAD+/wgA+f/+/woABAAIAPr/BwD1/wsABwD9//3/+f/z/wIA/v8BAAAA9/8CAAwA+v/4/wwA"
+     "/f8EAAgACgD5/wAA/P/1/wIAEAACAPn/CgAAAPX/AAADAPz/+v8IAAEAAwD1/wsACwD4/wcA/P8GAAcA/v8CAPz/+v/8/wIA"
+     "CQD7/wMADQD4//f/BAAFAAUADADz/wQACAD2/wUAAgD2//3/9v8FAAwADAD+/wEA/f///wMA+/8IAAEA9//7/wIA9v8DAPb/"
+     "+v8MAAMAAgD2/woABQAFAPj/9/8EAAEA9f/z/wUA+P8EAP7/9/8KAAAA9f8AAPX//P8FAPr/DAD3/wkA//8BAAUABwADAP//"
+     "/v/1/wwABgD7/wUA/f8EAAcABgADAAMACgD4//T/CQD0//T/AQD8//n/9//3//3/+v/2/////f8GAA0ABQAMAPz/+f/9/wkA"
+     "/v/3//r/9P8CAAsA+f/0//r/9////wwA/f8CAAYA/v8DAPj/BAABAPj/+v8KAAoABwAHAPv/9f8LAPv/AwAFAPb/AQALAAEA"
+     "9v/8/wYACQD8//f//v8KAPb//v8KAAUABQD0/wIABwAKAPP/BQD8/wwA/f/+//3/CAAIAP3/+f/0//n/DAD//wEAAQAHAPj/"
+     "AgAMAAoA9v8IAPX/+P/8//X//f/5/wEA/P////f//f8BAAUAAgANAAQACAACAP3/BgALAAkACAAAAAUACQD1/woABgD4//n/"
+     "+/////v/AgD5/wQA+f/5/wEA9//8/woA9v8NAPP/BQD4//T/+P8FAAMACAD3//z/CwD5/wUA+P8FAPX/BwD///T/9v8BAPf/"
+     "9v8EAAAA+f8EAPn/AAD//wgACAADAPn/+/8EAPj//P8GAP3/BgD4//r/AQD//wQABQAEAP//+P8GAAAAAAABAAkAAQADAPr/"
+     "BQD0/wIABwAAAPv/CgAKAP//BgAIAPX/CgD6/wUACQAJAPv/9/8HAP3/CwALAAoA9f/1/wUA+P8CAPT/DAD2//X/AAD5//T/"
+     "//8EAAYACQD8/wcADAD3/wQABAAJAPf/AgD//wIA/v/5//v/9v/5////CAD8/wgACAALAAEA+/8BAAQACwD1/wAAAgAIAPX/"
+     "//8DAAQA+P8KAAUACgALAPf//f8CAPT/AQD4//b/BwD7/wQA+P8FAPv/+v8IAAgACQABAAEABwD6/wkAAAD4//b//f8EAP3/"
+     "AwD1/wQA/P8MAAgA/P8KAAgA/P8FAP//8//1/wUAAQD7/wUA+P/8/wMA9P8DAAwABQALAPb/CQACAPT/AgAGAAoABQD9/wYA"
+     "+P/3/wgABwD0//f//f/7/wUAAgAKAPf//f8IAAoABwD4//T/AgAIAPT//P/7//X//P/9/wwA8/8GAPn/9P8HAPr/BgD3//j/"
+     "CAALAAkADAD///r/AwAIAPj///8CAPf/9f/2//f/AgD9/wcA+P8JAAcADAAIAPf/BgACAPb/AQACAAYA+P8MAAIA9//4//3/"
+     "9P8MAPf/BQANAAkA//8DAAYABwAHAP7/AwD4/wYA//8GAAYA/P8KAPj/AgD8//X/+P/2//r/DAALAAEA9v/1/wUAAgD//wAA"
+     "CwD1/wUACAALAPX/BQAGAAYAAAAHAAEAAQAJAP7/AgD8//v/+v8DAP3/BgD0/wwACgD5//3/AQAHAPj/+f/9/wgABwABAPb/"
+     "BwADAPn/AwACAPX/CQAJAAEA///7/woAAAAGAAYACwD0//f/9P/8//j/+P/8//X/9/8JAAAA+f8JAAMAAgADAPb/BwALAPn/"
+     "+//8//j/9v8LAPf/9v8FAAwA///3//b/BwABAAcA/v8LAAIA/v/6/wYA9v8IAPz/+v/5/wUABAACAAEA9f8AAAEA9P/9/wIA"
+     "BgANAAYA/v/6/wEA+P/7/wcAAQAMAAAABAABAPb/+f/1/wYAAQD//wgAAgAJAAUADAD7//b/BgD2/wEAAQD2/wEA/v8IAPP/"
+     "AgAJAAcA/v/3/wEACQD8////BgAHAPj/CAAHAPz//f8HAPb/+v/8//v/AAD5/wgABgD//wwABQD//wAACwD1//7/+v/9/wwA"
+     "/P/+//3/AQD5/wkACAAHAAcAAgAEAAQA9v8CAAYAAQAIAPj//P/4/wsAAAAKAPj/9f8GAPn/AwD9//3/BgADAAoABwD1/wUA"
+     "/v/5/wAA+f///woAAwACAPb/BwD5//7/BQAJAPf/BQD0/woA/P8JAAUACwD5//7/9f/3////AgAEAPn/+v8CAAUAAAAKAAMA"
+     "+/8BAPn/BgD4//T/9/8KAAgABAD//wcA9P8GAPT/+f////j///8JAPz/AAD7/wgA/P8EAPX/9v8KAPn/+//5/wQABwD6/wQA"
+     "AgD5//3/BQAHAAsA9f/+//T/+P/+/wkABQAFAPb/+v////b/+v8KAPf/AAAEAAkAAwD7//n/CQAHAPz/BQAEAAUAAgD+/wYA"
+     "/v/3//z/9v8MAPn/9P8GAPr/CwD///r///8EAPX/DAAKAP7/+P/5//T/9f8KAPv/+P/2//r/9////wgA/v8JAAMA9P/4/woA"
+     "BQAJAPb/+//2/wQA9v/3//T/DAABAAcA+v8KAP7/DAAJAPv/BAAEAPj/+v/0//P/DAAFAAUABQD8//3///8LAAMA+P8LAPb/"
+     "BQD9/woADAD5//b/+f8KAP//9f8HAPv/BAAJAAcA+/8MAAwACQD5/wEA9f8EAPX/AgD8/wYA/v/8//7/AgAEAAoA+P8CAAkA"
+     "AQD7/wcA/P8LAPr/9//8/wcADAD2//f//f8FAAQACwAEAPz/BAAKAPj/+/8EAPn/AgD1/wMACgALAPX/BgACAPX/BwACAAkA"
+     "BwAEAAUA//8CAP//AQAEAAoACQD///v/AwD+/wsA/f8IAAcA+P/6//r/+/8LAAcABgD9//3/AQAKAPT/9//4//r/CgD0//v/"
+     "/v/+/wgA/P8EAPv/+v8LAAAACQALAAwA+v8DAP3/+/8HAPj/BQD///X///8CAAoACwD3/wkACQD7//X/9/8BAPb/AAAMAPf/"
+     "AQD9/wwAAgAMAAAABAAIAPz/+v8KAAcA9f8AAAMADQAJAAQABAD3////9////wUABAD6/wAACQD///X//P/9/wQA9v/+//P/"
+     "/f/3/wwA9v8AAP3/CgABAAwA+v8FAAcABwD5/wYABAAGAP7/BgD9//X/BQAGAPr/9P/9//3//v/2//r///8LAAoAAgAHAAMA"
+     "/f/2//X/BwD2//T/+f/1//j/DAAKAPz/CwAFAP//9v8IAAcAAgD6/wcACwAHAAoACQD3/wMABAD4/wAAAgAIAAYADAAJAAoA"
+     "+f8BAAwABQD3/wAAAwAEAP7/+f/6/woA/f8IAPr/BwAEAP7/9P8JAAgA+f/0//T/9/8CAAAABQD8/wwA+f8AAAoADAD+/wcA"
+     "+f8CAPX/+v/9/wgAAwAFAPX/CAD1/wwA9v8LAAUA9//9//X/CQAAAP3/AgABAPj/+P8DAAAABAAMAAIABgANAPr/CQD6/wcA"
+     "+//3//r/9P///wEA/P8EAAwA9f/3/wEABQALAAoA/v8BAPf//P/0//7/DAAIAPj/BgD///r/CQD//wgAAwD1//n/BQALAAEA"
+     "AQAMAAkACQD5//3/AgAKAAYA/f8DAPT//P/4/wIA9P8KAPr/9f/9//3/8/8MAPv//P/2//f/9//3/wYACQD1/wAABQALAPz/"
+     "+P/5/wEACAADAAUAAAD0/w0A9v/0/wEA9/8BAPb/BAD3//3/BgD8//b/DAD8/wkABAD1/wgAAgAAAAwAAQAMAPr/AAAIAAsA"
+     "+f/1/wkAAgD2//b/AAD3//f/9P8FAPP/AwD7//3/+//7//v///8KAAIAAQD4/wYACQD+/wAABwAEAAIACAD8//n/+v/0/wsA"
+     "+P/0//T/9P8DAPT//P8CAPn/CQD0/wQA9P/8//X/AwAIAAEADAD5/wMA+P8HAAYAAwACAAEAAAD7/wIA9P/3/wEABgD3/wwA"
+     "9/8FAPn/9/8MAPb/+//6/woAAAADAP//BgAHAPz/9P/2/w0ABAAEAPn/AQAFAPv/+/8DAPX/BQD2/woA+f8HAAAABgD+/w0A"
+     "CQD0/wQA/v/3/wEAAAD0//r/9P8JAAMA+/8GAAIADQD8//n/9f8JAPz//f///wIA/f////r/CgD5//z/DAD5//7/CQD4//r/"
+     "BgACAAQA+//+/woA/v/8/wEAAQAFAPn/9P/0//j//P8GAAYA//8CAAMAAgAJAAgA9P////r/9f8EAAEA+P8KAP7/9f/0/wsA"
+     "BgAAAPX/+v/+/wYA+f////7/AQAAAAIACQAIAP//DAD1//v//P/8/wcA+f/8/wQA/f8BAPz/9v/5/wEADAD1/wwACAD3//X/"
+     "/P8GAAAA+f8FAAwACgAIAP3/AAD9//j/AwACAP7/AwD9//r/9/8KAPr/9f/4//z/CwAGAPT/CQD5/wEA9v8JAPf/CQD2//f/"
+     "9//4/wgA+////wwACgD0//f/BAAFAAEACwAKAAEACQAJAPf/AgAHAPP/AwD1/wIABQAJAAYABwD5//b/BgD6/wMA+/8GAAoA"
+     "BAD6//f/BQD2/wQAAgAAAAkA/v/8/wcA//8BAPT/AAAEAP//CQD5//r/+v8FAPz/+f8HAP///f8GAPv/+v/1//n/AwD+//z/"
+     "/v/9/wgA/P8CAPb/+f8AAAsABgD8//X/AwACAPb//v/5/wMA/f/8//j/AQD8/wsABQD9/wsACgD5//v/AQALAAsA/v8HAPz/"
+     "CQD//wQA///8/wIAAQD7//r/BQAJAAMAAQAIAPf/+v/3/wQA/f8BAAQACgABAAIABwD4//T/9//+//b/BQABAAwA+f/9//b/"
+     "CAD8//z/9P/w/wYA//8BAAEADgD1/wwA+v/8/wEABwAIAPT/9f/6//j/AQD1/woACAD+//f/CQALAAMABwADAPf/BQD6/wkA"
+     "BgAFAAUACwAEAAsABgD+//f/+v8LAAIA9f8HAPn/+f/9//v/BQACAPn/+f8FAP7/DAAGAPT/CwD7//v/BAAAAAsACQD7//T/"
+     "/v/8///////1//P/9P8FAPv/9/8IAP//BAD1/wsACQDz//T/DADz//b/BAAFAPP//f8DAAIA+f8AAPT/AAD//wAA//8LAAQA"
+     "///2//X/DAD5//X/9P/3/wgABAD0//b/CwD3//T//v/5/wsA/P8EAPj/9/8EAAoA/v8FAPz/+//5//j/AgAHAP7/AAD2/woA"
+     "+/8MAAgA+f8EAPz/CwAFAAEAAgALAAcA9v8MAPb/AQD9/wwA+P/+//X/AwD///b/+f/z/wAA+P8KAP3/BQD7/wAABQD0/wAA"
+     "/f8LAPv//P/7/wgA+/8EAPj/+//5//n/DAD2//T/DQAJAAgACAD0//f/9/8BAAgA/f/8//r/BwAHAAMABwD3/wkA+//5////"
+     "BAAJAAQABAD//wEA//8EAPv/DAAIAP7/9f8GAAgAAADz/wMA+P/5//z/BAAJAPv/+f/0/wcADAAIAAAACAD//wgA+f8BAPn/"
+     "AwD8/woACwD4//f/9f8IAAIACwD9//v////0/wQA9v8AAPX/AAD6//z//v///woAAwAMAPz/9P8MAPv/AgANAAoABwD+/woA"
+     "/f8LAPf/AQD7/wwAAgACAAwAAAANAAUACQAAAPb/CwAHAP//+P////X/BQADAAwA9P/+/wMA9P8MAAgA9/8AAAMADQALAAIA"
+     "9/8LAAcA+P/9////9P/2//3/+//+/woADAD1//T/AAAIAPn//f8GAAgA9P/5/wkA+v8JAPz/9v/2//X/BwD9/wkA+v8LAPj/"
+     "AwD6//n/9v8JAAQA/f/6//X/BwAMAAMAAAD3//r/CAAHAPr/AQADAPb/9/8JAPT/9f/1//v/9/8DAPv/AgAEAAEA9P8AAAIA"
+     "BAAIAPz/+v8EAAwA/f8DAPb/BgD7//b//v8AAAoAAQAEAAoAAgD6/wEA/v/2//3/+v/0/woAAgAFAPf/BwAIAPf/+P/3//v/"
+     "CQD6/wwA/P/z/wkACgD+/wQABAAFAP///P8FAPz/+//3//z/+v/8//n/CQACAAUAAQD+/wUA+//3//z/CgAMAPf//P/8/wgA"
+     "BAAHAPr/BQD2//b//v8AAAEAAgD8/wQADQAKAPz/+v8BAAkABAD4//r/8/8IAPr/9v/3/wMACAD5/wEACAANAP7///8FAP3/"
+     "+v8DAAAA///3/+7/AAD1//n/CwAJAPv/DAAJAAIA+v8NAP//AwD4//T/AgADAAkAAgD7/wQA7v/7/wYA/v////L//P/9/wUA"
+     "8P/0//3//P/1/wEA8v8GAPf/8/8OAAYADgD6/wIA8//q//r/BwD6/wsA6f////b/BgAMABIAAQD6//3//f/8////AAD2/wgA"
+     "+v/6/wYACwD6/wQA/P8DAAwABwAJAPD/9f/4//j//P/2/woACgAKAPb/AgDz/woA+f/+/xIA/P8KAPX/EQD3//n/8//4/wIA"
+     "AwD+/xMA/v/x//v/BAABAPD/9v/2/wwAAwAFAP3/9/8EAPT/CwD2/w4A+/8FAAIA+/8OAAwABgABAPz//v8IAAQA+P/y/wgA"
+     "DAAAAAMAAgAIAAQA8/8NAAYA9/8IAO3/+P8DAAQA9f8PAPj/7f8KAP7//P8HAAIA7f/3/wgADAALAPj/9f8HAPz/DQAEAAoA"
+     "CwD7//3/9f/3//X/+P8DAP//+v/4//3/DwACAP///f8JAPz/BgD9/wAA+/8OAPb/BwAKAPn/AAD2/w0AAQACAPv/+f8HAPv/"
+     "EQADAAQA8//v//j/CQADAPb/BQDx/xMAAgD9//3/EAD+//L/CQALAAUACwD0/+b/BQAFAAEA9f8GAO7/AQAAAAQACAAJAAoA"
+     "AQD2//3/9P/2/wsA6//2/wYABQD4//b/8/8CAPT/DQAOAP3//P8CAAMAAwASAPP//f/9//n//f/5/w0AAwALAAYABAACAAgA"
+     "9f/7//7/+//2/woADAAKAAkACwAAAPX/BgAAAPj/+f/6/wMA+/8HAP3/AQAMAAMA+f/5/wYA/f/4//f//v8KAPv/AwAFAAAA"
+     "CAAGAP//AAD6////+//2/wUACgD4////CQAGAP7/DADz//X//f/1//7/BgAKAPP//f/3/woAAAD9//j/CwAEAPT///8DAA0A"
+     "+P8FAAgAAQAGAAQA9P8CAAoAAAD7//7/BAAMAAMA+f8JAP7/9/8FAAUAAgADAP7/AgACAAoA+f8DAP//8//2//b//f/4//b/"
+     "9P/+//7/AAD3/wgA+P8FAAkABwD8//3//P/5/wMABgACAPP/CQALAAoA+//9/wsACAALAAwAAQALAAMACQD3/wEACgD3/wMA"
+     "AAAIAAMABgABAPv//f8EAP3/+v8MAAEACwANAAEAAgD4/wEABgD7/wMA/P/3//r/+v/1/wYACQD///7//f8JAAsA+v/6//T/"
+     "+//9//v/CQD8/woA9v/9/w0ABQAMAAgA///8//3/DQAIAAkA+f8MAPj/AAAHAPf/9v8LAPn/CQD9//v/BwACAP7//v/2/woA"
+     "9v8FAP3/BQALAAIA9/8CAAgA9//5/wMACAAGAPn/9//8//T/9f/2//r/+/8JAAsABAD//wcA///1/wYACgD4/w0ABwAIAPf/"
+     "AQABAPn//P/6//z/BgD//wkA/P/3//7/+P/7//j/BQACAAwA+v8AAAoA9P/4/woA/f/9//D/BwADAAAAEwD2//b/9/8RAPr/"
+     "8v/4//L/EgD7/wYA//8BAPb/8/8KAAcADwAUAOj/6v8TAPn/8f/z/+r/7v8DAAcACgD0/wIA8v/8/wMABgD2//T/4//r/wkA"
+     "AQDw/wgA9v/z/+//CAAUAAsA/f8HALL/GgD1//P/AwDl//T/+/8AAAMA9v8SANz//f/q/yMA9v/r//v/3P8ZAPX/FgD3/wUA"
+     "6P8AAAoA/P8WAAwA5P/F/zIAAwDh//P/6/8CAPv/BgAiAOf/HgDm/97/8/8dAP3/AQDv/7z/BwDz/wAABAABAO//8P8aAP//"
+     "LwA/AOv/2v8yAPb/vv/y/+j/AAAKAPb/BAD+/zAA2//f//v/IgD7/+P/zP/Q/w8AAwAJAPP/7v/3//P/CQARABIAFQD4/8z/"
+     "NgAMAP3/DQDu//3/9f8DABMADAAfAPf/AQDx/yEA7//s//r/3/8GAP7/7v/7////6//c//3/EwD3/xIA6f/P/0QA9f8EAP3/"
+     "+//+//L/EwAMAPr/FADy/woAGAAJAAcAAQDv/8L/AwD7/xcAEQDv//b/8v8EABkABQAbAP3/xf8fAPL/4v8IAPn/BwD7/xgA"
+     "EgD5//n/3f/t/w0ABAD0//X/8P/o/zUA/P/u/wgADgAIAPf/CwAKAPn/AwAwAO7/DwAOAMn/7v8AAAAA8f8TACIABAD9/+L/"
+     "9v/n/xAA6v/7/+//x/8VAPv/6/8LAP7/8v/3//f/9/8NAAQA5v/6/0IA9//5//P/0f///wEACQD0/+n/DgAIAAEA8P8jAPj/"
+     "8//r/8H/DADq/wMA8v8QABEADgAUAA8AFQAbAAMAw/9HAPb/9P/6/9//8P8BABYAFQDl/zEA6//4//H/HwD3//r/7v/k/yMA"
+     "3v8HAP//DQD7//v/AwAFAAMAGQDm/8P/IwABANT/8v/b//r/8v8IAAcA+v8PAO3/7f/r/x8A7//+/wEA0f8EAOn/EwDx//r/"
+     "CQD0/xAACwD//x0A7P/7/wgA/P/b/+3/8f8DAPr/9f/1//b/AQDl/+3/AwAcAP//+//+//P/BAAMAPb/CQALAP7/8v8TAPr/"
+     "/P/6/wEA+P8YAOz/BgDv//j/7//7/wEADQD6/wcA+f/3//z/CwD//wwA+v/4//r/8f8AAPv/9/8HAAYACgAAAPj/FgDy/wEA"
+     "HQD+//P/BAD6/wAADAD3//3//P/8//v/9//5//7/+//0/wIA+/8GAAAADQACAAUACQAAAAoACQALAPr/AAD7/wMA9/8MAAIA"
+     "BwD9/wgA+//8/woAAgAKAPX//v////j/AgAGAAsABAAMAAIAAwACAAQADAD5/wwAAwAFAPn/9v/8/wAACQABAPr/+//6//7/"
+     "/P8KAAkABgALAAAA9/8BAAMA//8FAAIAAQD2/wYA+f/2//j/+f8BAAgAAgAKAAcA/f8AAPj/+/8HAAoAAwAIAAoA9v8KAP//"
+     "DAD7//j/9P/4/wsAAAD6//v//v/+/wUACQAEAPT/9f8HAAcABAD1//X/BQD4/woA+P8CAAkA9f/8/wgA9/8AAAgACgAAAPj/"
+     "AgD1/wwA+P/+////CwD1/wQA9v/+/wcABgD+//7/BQABAAUA9P/0//f/AAAHAAcAAwD1/wIA/v8DAAMAAQD1/wQACgAKAAgA"
+     "9/8MAAMABwD4/wUA+f8CAA0ACAAGAPH/+v8BAPX////w//X/+////xAA2P8SAPn/BQD6/xgA+f/w//T/8v8HAPT/9/8DAAsA"
+     "+v/p//j/GAAAAAkAAgDm/wsACgD6/+3/BAAIAAMACQAFAPv/FgDy//3/AgAXAA0A5f/a/8v/IgD+/wsACQD6/wsABQD5/wYA"
+     "AwD7/8n/r/8uAAwA7f/7/9v/5f/2/xgA/v8CAPz/6P/t////NQDS//T/0P/l/xQAEADn//b//P/b//H/GQBMABcAAgAXAH3/"
+     "TAASAAUA/v/k/+T/CQDu/wAA7v8GAPb/8v/8/+f/GADi/93/tP8hAAsA5v8RAPH/3f/1//z/FQAJADAA8v9Y/zQACAC7/xAA"
+     "7P/5////GQALAMT/NADe//b/BABCAP3/o//A/9H/GQDs/wEAIQAVANf/8f8NABEAHwA8AN//qP9CACoArP///+L/2P/w/wUA"
+     "6f8LAA0A5P/G/+P/QQDv//r/2v/c/x8Av/8BAPj/JgD2/wwAFwAaAD8AGQDt/27/SAALAO3/9v8NAPv//P8OAAIACADi/wAA"
+     "zv8sAB8A+v8RANX/2v8lAO3/IQACABwA4P8TAPL/CwD9/zUA+f+g//z/EwCG/wAAQQAYAOX/FQDt/97/GQAKAN7/BAA4ACkA"
+     "HAC6/8P/LgAGAAIA9/8jAAkA+v/+/0AA+/8jAOP/mP/m/wcAi//+/+L/AAD5/xQADgDh/x0A3v/w/wcAOQDo//r/x//c/xwA"
+     "3v/3/xMA/f/0//n/9v8NAOb/IAD5/6b/7v8KAOT//f/h//v/7/8dAPH//P8sAOv//f/1/zgAAwAAAML/v/8mAKz/7/8eAAcA"
+     "CAD4////NgDU/woAAgB6/zQA//+4/+3/4P8ZAOb///8BANv/IAD3/+L/FwBUAAQAAwDN/+X////J/wsAKQAJAAwAFAAoADsA"
+     "9/8/APf/9P82AAsAp//0/wMA///8/w8ACQDt/zIA3/8JAAwAGwDw/wUA9//8/xMABgDm//P/DQDu/w0ADgD2//n/MwAGAND/"
+     "JwD7//X/9//r/wsA7/8EAP3//f8KAOD/6//y/yMAAwAIAO//1/8KALz//v8BAAAAAgDp/x0ABADe/woA/v/5/ywAFwDn/wEA"
+     "8P/9//X//v8EAP3/DwD2//n/8/8AAO//8v8DANz/DwDj//n/CgAAAOn/8f8YACIA+/8NAPL/9f8dAAQA+/8AAPf/DAAFAAkA"
+     "CAD8/wsA+v/7/wsACQAKAPb/DAABAPf//////wsAAQADAPr/BwAEAPX/AQD///X/AQD6/wcACgD7/wEAAwD+//T/AAAGAP//"
+     "AgABAPn/AQD6/wIADAAKAPX/DAAJAPz/BQD4/wcAAAD2//z//v8GAPz/DAABAAgABQAFAPj//v/0/wcADAD8/wQA+///////"
+     "CgD3//T/CQAEAPX/AAAEAAgABAD///r/+v/5//3//v/2//T//f/0////BAD9/wgABwALAAYAAwD5/wAAAAAHAAoA/f/9//v/"
+     "/P/1/wEA9//6//v/AgD3/wUA9v8EAAMAAAAFAPT/BgD8/wUA+v/1//7/9f8KAAQACQD1/wEABQD0/wgACwAJAAwADQD9/wMA"
+     "9/////3/AwD2/wMA/v/4////+f/5/wQA+/8FAPX/8//0//r///8DAPf/9/8MAP7//f/7/wUA/v8HAP//+v/7/wcAEAAJAAsA"
+     "CgAIAAIABQD5/wAA9P8IAOb/1f8DABAAAQDm/wwA7v/z/+f/GAACAOD/BADi/woA4f/7/+n/EgDz//X/CAAFABgACAD5/8z/"
+     "FQDw/+7/AQDs//z//v8TAAoAoP8KAPb/8P8YACsA8P+N/+P/+v8eAAkAEwAPAAAA7P/1/w8ANQAIAPP/GACj/x8AAgDz/wMA"
+     "8P8NABwA+f/+/xoA5v8JAPv/BgALABYA7P8rAKn/JgAbAOT/IwATACwA7v8WADIA4v8xAIT/Sf8UABAADQCg//f/BgAFAAUA"
+     "AAAIADwAyf8AABUAKwCZ/8b/xP/k/x8AAQD5/+z/HACx/wIA5v8PAPT/BQAuAH3/CwD3//D/DQD2/+3/3//w//T/CQDm/w4A"
+     "GgD0/zQAJgDR//n/+P8wAPH/EwDw/ywAi/8TAOX/OAAjACIAEwB8/wkAxf/X/wsADgD//+z/6f8BAPn/BQD1//3/CwAaAOT/"
+     "5v/h/wUAJwDm/ysACgArAPP/+P/9/xIA+/89AAYAc//1/wMAuv8GANn///+m//r/2/8QAAYACgAVAPb/EQAFAAIA2f/e/xcA"
+     "8f/i//j/3f///wMA9P80ACEAIQD6/83//f91/1j/9//z/+v/wP/s//X/CgAIAJ3/G/8AACYABAABAPL/6P8fAAYAOgD7/9//"
+     "5/8OAOT/CAAfACYA+f/i//b/FABu/xEAFQDr/9n//f8RAPj/DQAHAPz/EgAeAB4Azv/v/+z/MwDI/wEA8v8nAOP/AwAHAAQA"
+     "VgABAP7/j//u/+r/rf/i/+7/7v8DAOb//P/y/zUAJwDg//T/HAD9/8//sv/x/zIA+P8FAN7/bQD4/wEAAQAxAAcAKAAGAAgA"
+     "FADP/97/7v/Y/wAA6f8DAO3/1P8eAAEAFgAJAC8AAgALAOf/2v8kANf/n/8UAP3/KQD8/xQAIAA4ADwADwDo/wYAa/8SANP/"
+     "IADq//n/8//2/wQA8v/N//D/5/84AC4AGwD4//X/dQCT//7/9P8MAAYAv//O/0QAFAAcAOn/8f8pAC0ADgAPANr/EADm/wMA"
+     "EAD9/yIA+f8PABAASQAGAOn/9P/V////0f/4/yEADACx//3/BwAcAPb/OgD6//z/SgD1/+X/1//k//H/+f8VAAYA5f8GAOX/"
+     "/v/1/xgA6P/j/wkA7v8OANv/EAD8/w8A6f/+/ywABQAKAB8A/v/s/yQA///w//v/DQD+////AgAMAAUA+P/7/wIA+P8FAPX/"
+     "AwD4//7/DQD5/wcA8/8AAPP/AAAHAAEA9/8IAAIA9//8/wYABAD4/wgA//8DAPz/+f/4//z//f8EAAoACAD7/wYA8//5/wsA"
+     "CwD8//r/9v8DAPX/+f8JAPb///8BAAIA9v8CAP7/9f/9//b/AgD0////+v8KAAgAAgD7//v///8LAAsA9f8AAP//AAD8//r/"
+     "BgD5/woA+P8EAAIA/P/5//n/CQD8//n/+v8GAPX/9f/6/wwA+f8LAAoA+f8CAAsA9P/7/wwACgAGAP7/DAD//wwA+P/0/wsA"
+     "CgAHAAEA+v8CAAgACgD+/wIA/P8AAPv/+v////f/BwACAPT/9f/7//X//v8JAAgA/P8MAPf/BwAEAPT/AAD0/wMABgAJAAQA"
+     "9f/3/wcABgD+/+j//P8EAPz//v8JAP//9/8AAAgA9/8GAAYAAQAFAPH////x/wAA+//7/wYA9v8JAP//AAD2/wYA9v////r/"
+     "4v/R/+//AwATAN//JQDt//f/9P8GAOz/pv/w/9z/IADl/wUA9f8KAAoA8v8VABMADAAtAPD/0f8pABAADAD3//j/zf/t//n/"
+     "AQDu/ycA1f/+/yMAQAAAAHH/5//L//z/BADu/wIA4//m/xAA8/8FAEcAFgAqAGz/DwD7//T/9/8OAO3/6P/r//b/BP/y/8z/"
+     "+/8KAC8ACQCO/+r/1//K//f/7f/4/xAA4//5/9r/GwAcAAsA4v+5/w4AAQD0/w0A7P/0//X/BADo/wAAAQAcAAUA8//t/8z/"
+     "4f8aAPH/7//6/yYAHAAdAA4AEwDb/wMA9//h/97/tv/j/wMA8/+f/wsAAAAMAPj//f8DAEAAAAD///7/8f/o//L/6P+u/wcA"
+     "FwAmABEAAgDM/wUA9//+/wwAFQD0/5z/6P/x/wAAEwAVAAwAzv/4//v//f/z/8X/BwAWABAA//+7/+X/8f8EAOv/+f8TACUA"
+     "3/8FAOH/AwAmABMA7/+Y//v////t//T/EAC4/wMA9P/1//v/GQDp/wgABAAJAPL/AwAuAO//AgDw/w4AGwADAPL/AwDj/+L/"
+     "9P8MAAAA2/8NAFP/kP/B/wUA9/8WAPz/AQAEAB8AIgAC/wAABAAPAPT/CQADAP3/8f8VABYAJwDl/wUABwAOADkAAAD0////"
+     "GgD//9v/7f/2/w8AFgD7/wEAAgBGAK///P8FAO3/EgDv/xsAvP8JAPz/8v8PAOb/3/8IAO///f81AAIABAD0/wwABQDd//f/"
+     "HQD+/1f/CQD//wEAMQDQ//3/CQD7//v//P/8/wgACQDw/xAACADv/wcABgAUAPv/dgAOAOn/7//z/9X/9P8eAOn/EwATAAQA"
+     "BAAAAFkADwDu/xEADgD9/wEAAADx/+7/3/8WAAMAAwDr/wL/6P8FAE0A/P8AAAYACwDx/+z/5P+X/wcADwD1/+z/4P8AABAA"
+     "5P/1/0kAEAAMANj/+f8PAJf/AgDZ/wEAt/8DAPb/BgA+APn/+v8DAAMAHgD4/+v/3f8ZAO3/AQD9//H/8//v/+3/NAAMALX/"
+     "GADq/9r/IwCx//L/CAAJALv/KwAIABcA8P8nAOn/9f8mAPD/9f8AAOL////w/wUAEAD2/yEA+v/x/+3/JgDu/wIA9//v/x8A"
+     "xv8DAPj/AQDp//P/FwAnAPz/DAC7/+X/IAD8/wUA9//3/////P8KAPb//f8FAPP/+P/6/w0AAQD0/wUA///6//X/BAD9//v/"
+     "AAD+/wsABgAFAPj/7//0/wEA+//+//j/DAD3//f/AQASAPz/CAD6////BQANAAYACQAMAPf/BQD6/wYA9v8IAAwA+v8AAAoA"
+     "BQD9/wMADAAJAPn//P8KAPj/CgD7//f/AQAGAAkA9P8MAP7/9f/9//T/CAD4//3/AwD5//b/+f/4////+f/4/wMABgD0//n/"
+     "DAAMAPX////6/wMACQAEAAYAAAAFAAQACQD0/wwABgD6//3/AAALAAkABwD3////AgD4/wMADAAHAP7/9f8DAAQA/v/2/wMA"
+     "+P8DAAUA/v8IAP3/BgD8/wcA/P/2/wkAAwAKAAAA+P///wYA+/8GAAYA/v/7//j///8IAP//9v8FAAgAAwADAPf/6//6/wUA"
+     "BAD6//7/9f/7//n/BQD///r/AQD5/wQAAwDz//P/CgD7////BAAMAAwACgDk/wgAAQD5/wcA8v/w/8r/6P8IAAEAz/8MAOb/"
+     "AgD2/xkA+v8CAOz/7v8qAOL/7v8IAPD/7P/5/wsA/v8MACUA/v/V/10ADwAJAAwA/f/2//n/+v8DANr/JwDl/+r/AwA4AN7/"
+     "av/0/8v/GwDk//n/FQAMAAEA+v/s/ysAHgA7AO7/pf8/AP//AwAKAOP/xP8CABoA6P/z//v/7P/4//f/GwAXAJD/6/8JAC8A"
+     "yP8bAOv/JwDf//n/3/8tAPT/KAAcAJP/CADs/wMA+v/W//H/q//y//D/hP/2/+z/9v8RAPr/5f/J/xEApv8VABwAHAAHAPz/"
+     "/f8GAPv/AwAEAA4A7P/U//D/EgDg/wMA9P/l/w4AAgBkAPf/+//2/wQADQAAAPX//v8YANr/+P8PAP3///8vAAMABwDy/xYA"
+     "BQATAOz/2/8AAPj/6/9mAOb/+P8EAPj//v///z4AOQAEAPb////j/9r/CQDz/wwACwD1//z/GwDh/wkA9v/z/+X/GADc/9X/"
+     "FgD//+7/BgDN/xgA/v/4/wEABAD2/7r//P8CAAgA8P/z/xAACgAAAAcA+P/0/1UAAAADAOn/CwAsAAYACQDp/xIA+//7/9b/"
+     "AwAFAK//AwD3/wIAPQDi/wL//P/9//L/8v8RAML/AgD//wAA+f8jAPT/AgDj//n/CAAPAPr/5P8lAPf/9P8OAOT/CwAjAP3/"
+     "9/8DACsA8f8AACkA9v/P//r/MAAEAAEA6f8MAPT/QADk/wUA2P8GAJkADgAQAOb/HwD+/+n/6/8CAAYAEwD7//3/AQBJACUA"
+     "CQADAP3/5//6/w0Au//9//v/DAD4/+f/5P92/97/9v9SAAsA9P8CABQACADm//L/+v/n/+r/+P/6/wcAEwANAPf/EgD4/+n/"
+     "CQAhAPz/CQDF/yUACAAJANL///8CAPj/ZAAbAP3/AwAHAAMA5//n////BACf/wsA///s/zsA2v/z/+X/SgDC/wUABgDf/zwA"
+     "0/8YAOX/GgDQ//n//v9BACYALAAXAOz/DwAGAO//5P/M/woAAAD0/wUA8P8EAOb/AwAEADgAuv/5/xYA7f83AL//EAD5//j/"
+     "KwD3/wwADADA/wcAbP8JADkAIQD2/wYAwf8bAAEA///7/+z/GgD2//7/9P8lAN7/9v8MAPH/BAD4/xAA8f/4//X/BgAdADsA"
+     "IgAIAPL/BAA8AA8A7P/8/wIAAAAFABIACwD0/yEAAQD3/wgA/v8CAAEA+v/s/w0A+f/6//L/+/8HAAQA+P8EABAA+P/0/wcA"
+     "DgAGAAoABgABAAgAAAD//wwA/v/0//r/+v/4/wMA9f8GAPr/9v/2/wEACQD4/wQA9v///wMA+v8AAAEAAAD///v/CQD+//f/"
+     "AAD6/wMA9f8LAPn/+P8IAAsADAD9/wwAAwD6//T//P8DAAQADAD0/wIA+f8LAAoABQD3/wcA+v/7/wwACAD6//b/CQAMAP3/"
+     "AAAAAAcA///5//v/9P/1//v/+v/z/wIADAD4/wcABwAEAAcA+P8IAAUA+P/1//7//P/6/wwA9P8AAAQADAD7//7/+P8KAAQA"
+     "BAAAAAwA9//9//3/BQADAAEAAQD9//X/CwACAAUA9v/2//T/9//6/wAA+P/6/wcADAAGAPz/CAD9/woACQADAPD/AQAGAAoA"
+     "8v/u/wUA/f/0//X/AAD0//3/CgD7//f/9P/2/w0ACgD6//P////5//H/AQD4/xEADwDk//r//P8FAAEAEQD2/+n/9P/2/ykA"
+     "7v////f/DQD9//D/8f8MAPL/BQDf/9f/OADr/wUA7P/H//3/+v84AOv/AQBFAAMA+v+m/0MABQCR/+3/6/8mALL/8P/y/wwA"
+     "+f8AAAoAIgAIAB8ABwBw/z8A9f/w////HgCW/7f/DAABAPH/9v/9/xkACwAiAAIAof8FACMAJwD1/xwA5v85APb/+/8HAEwA"
+     "+P8oAMv/c//5//v/AwDl/+n/9v8kAP7/9//3//T/+P/x//v/8//1/8z/EQAGAPv//P/r/wEAMAABAAwA9v////r/CgD0/4n/"
+     "BQDy/9H/5P/v/wQA6v/4//3/m//x/83////7/wAABgDX/w4AEwASAAAA7v8CACAA+P8FAO3//P/f/w8A6//V/xwACQDW/+//"
+     "EwD3/wgA9f/cAAEA/f+m////CAAHAAQA6v/y/7H/AQDf/9n//P8iAPL/BQACAAMA8f8KAO3/3v8wAP//7v8kAPn//P+l/+f/"
+     "9v8AAFUACAAHAPr/+//p/+j/x/8MAPX/9f/N/wEAAwDp/wgAJgAAAAEAAQDv//H/NAANAPX/zf8CAPP/QADr//T/AQDz/yAA"
+     "5/8AAAIA/f/4/+L/8f/9//T/pv/5/yMA8f8GAP3/8P9ZAPn/3v/w/y4ADQDm/w4A8f/3/8L/8//5//z/SwAIAAUA//8FAPH/"
+     "/f/z//7/BwDW/+L/+/8+AOz/iP/g//v/VAD9/+X/9v8pAP7/7/8AAPf/DgAHAPX/9P8CABoAeP8CAAEA/f/5//r/KwDJ/wQA"
+     "+//e/xcANgDa/wgA5v8GAJAAHQDk//z/HgAQAMb/9f8eAAgA0/8AAP3/AQBTAN3/CgD9/xMAGQAUACwAFAAJAAQAAwDm/wUA"
+     "6v8EAOb/CgA0AAsA+/8MAA4AFADm/83/JAAHAB4AFAABAPD/MAAAAOT/DAAvANn/6v8tAPb/MQDK/xoAAAAzANb/BQDy/zAA"
+     "SQAoAIT//v/l//f/AwAKANL/FgDm/wgA/f/R/zYAyv/z/xMAPADv/97/HAD0/wgAqf//////9f8HAPj/BwAvANb/DADD//H/"
+     "/P8TANb/BADu//L/AgAHAA8ACwAIAO7/7P/0/0QA/f/g/wYA8/8FANj/4P8HAAoA6P/x//3/PgAHAA4Az//6/z0A+P/3/+3/"
+     "BQD2/wwAAwAFAP3//P8CAAMA/v8GAP7//v/7//3/AwD3/+//8//w//j/9v/0/w0AAAD8/xEAAgD2//r/9//4//r/AgAFAAYA"
+     "CAAMAPf/BgD//w0ADQAIAP///v8MAAIABAD2/wEA/v8EAPP/+//5/wgA/P/8/wQA//8LAAkACAD+/woACQD4/wsAAwADAPn/"
+     "9/8IAPj/+P/2//f/BwAJAP7/BwAHAAYAAQADAPz/AwD3/wQACwADAAEA+P8AAPz//f/3//f/AwD6/wcA9P8FAAUA9//+//7/"
+     "CQABAP7/9P8GAPr/AwD2/wwA/P8GAAMA9v/3/wgAAwD0//3/+v/9/wgA9/8CAPv//v8MAPf///8CAP3/AgD2/wQAAAAJAPX/"
+     "/v8FABEA/P8DAPn/AgD8/wgABwD//woACwD3/wUA+P/v//v//v8KAAMA+f8HAAsA6/8JAA0ABQD2////8v8TAPb/+P/5/wsA"
+     "8f/6//T/AgD9/wIA+v/1/wAABQD5/wUA7f/P////FwD0//P/EQDj//j/AgAOAAUA0v/6/9r/DQDd/wQABAACAB8A5P8NAA4A"
+     "AgASAO7/yf8YAOr/CQAIADYAzf/r////AgAFACsAxf8JAKX/OwAJAHn/9//Z/wkAtf8SAPr/IgAJAPf/3v8cAAcAOAD1//X/"
+     "0f8RAO7/DAD3/+T/tP8LANH/HADk/xYAAQDo/zUADQBU/0gA3/8fABgA5f/6/+X//P8UAPD/EwDY/ysA9v/w/8n/U//5/ycA"
+     "+/8OAOn/+f/1////0f8J/wQACwAAAB4Alv8XAPX/DwDZ/9r/+/8QAA0ABQDo/wsA8P///wYA8/8HACv/9//x/+D/7f/N//f/"
+     "/P8BAP7/TAD8//H//P/U/+v/CQDc//j//f/o//v/MADj/wEABQD+//X/AQD7/+X/HACp//b/CwDr/wIAHgD0//z/3/8bAEEA"
+     "/v/t/wMAAwDc/93/HAAAAO3/1P/5//D/5f8DAPf/DwDx/wMA9P/z/zcA9f/p//j/6//j/wgA9v/cAP3/DAAaAAMA9f/5/+L/"
+     "9//z/6b/8P/0/7v//f/3//7/BQD2//T/FAD5/+//7P8kAJD/9v+I/+b/DgDn//n/+P8AAE0ADP8Z//X/+f/4/+f/0P8bAOv/"
+     "8//B//3/7P/l/+b/FgABAOP/9v/0//X/MADw//f/+P8LAPj/rP/7//v/AQADAC0ACQAGAPT/AwD8/9v////5/+b/wP/0/zwA"
+     "5/8FABIABgBMAPL/9f/z/yUA3f/1//X/vv8PAC8AAAD6/wYAXAAiAPv/+f/6/xUA7f8qACIA/P8CABAA/v9CAMP/AwDb//r/"
+     "AwALAO3//f8IAMT/9v/j/xQA8/8EAP//9v8BAFAABgDx/wYACADu/xwAQACA/wEA9//s//j/FACK/wYA2v8TACoABADx//D/"
+     "GwBK//z/8P9HAN//4f8PAPr/AABbANL/CgDz/yYADQAaAFIACwAXAND/LQAWAOL/Vv8NABEAJgARACcA3v/+////EAABAPD/"
+     "KwARAPD/DwACAOz/EwD3/xcAAwAWAOz/DAAaAMf/JgCE//7/8f8NALH/AADn/yIA5v8VAM//FwDS//f/AAAVAN7/MAAEAA4A"
+     "OwD0/+L/3v/0/wwAEADq/wsA7P/h/x0A3P/x//T/8//4/wgACwAdABQADADw/zoADwD3/wcABwAKAPn//f8CAP//BwACAPv/"
+     "+f/4/wIA/P8JAPv//P8OAAcACQABAA8AAQD9/wkACgAJAA0A7f8NAPP//P8IAPv/BgAGAPn/DAACAAYABQAFAAoADwALAAQA"
+     "DAADAAYA+v8AAAcABgAHAAkA/v/9/wUA/P8CAPP/BgAEAAIA+//1//b//f8CAAYADQD7//3/AgADAPj/9f8JAAgAAgD1/wcA"
+     "BgD///n/CAD+/wYACgD///7/CQAMAAcABQD8//f/+f/1//T/CQD0//3/+P/+//r/+f8CAAUABgD4/wQA+v8GAAgACAD4////"
+     "BAAIAPf/9P8JAP3/CwD8//v/9P/4/wYAAAD7////AAD///b/BgADAPj/BAD2/woA+P8AAAoA+P8DAPj/CQD8/wMA/f8GAAgA"
+     "CAACAAUA+//9//3/DAAKAAEAAgD4//3/+f/3//X/+f/9/wkA+P/w//X/BgDw/wMA6/8AAAEA/P/5////AAAOAAsADQADAPn/"
+     "AAAGABYABwD1/7v/9P8OABUA5//4/+j/CwD7//v/AwDR/+n/5v8GAPX/7P8BAAIADwDz/yUA9f8bABUANQD2/zYACAD//wcA"
+     "TADJ//T/GwDx/wwA7P/g/wcA5f8dABEAY/8FALH/DQAWAPT/CgAOAP3/AwD4/zsAAgAsANf/vv8QAA8A8v8CADAAk/8AAPD/"
+     "7/8GAN7/GAD+/yAAAwD4/0r/BQDg/ygAHgD//wkA6P/p/xUA6f8fAPH/IQAGAOD/yP8SAB8AIwD8/6v/AQDz/wMA///+/wUA"
+     "7//s/wgADgDI/xAA/v8IAAMA3P8QABIA+f8OAP3/EQDq//H/4f/4//7/CAD//9r/2v/p/x4AZgD7/wQAGADa//v/AAAHAOv/"
+     "8f8bAMf/BQDv/97/+v8lAPD/AwDy/xQA7f8HAP3/6f8bAAsAAgD+//X/9v8C/7cA+P8DAP3/rf/8/+P/AADt/+T/8v/1//X/"
+     "/f/I//7/2//6/wUADQAAACYABgDv/+r/OgAEAAIA/v/p/8D/GADhAPP/aP/0//P/AADt//3/7v/y//v/DQD9//v/uv8DALf/"
+     "+f8d//f/+f/m//f/+v/w/zEACwDx/+n/7/8DACAA/AD7APv/8P8QANf/7//1/+n/9P/6//j/8//+/7f/+P/z/+7//v/j/wkA"
+     "BgD+/+v/8v8mAAcA8v/9/wcA8v82AOkA+v8DAFUA+f8DAAEA+v/W//L/9P+s/+7/+P/L//n/EADy/wwAPQD0/wMA9//x/wIA"
+     "IgAGAP3/CQDy//3/Fv+sAPX/AgD4//D/8/8BAAIABgDv/x8A8v8IAAQA/v/2/0IA//////7/9f89AAwA4f8AAAMA//8LAAIA"
+     "AwABAA0AYADx//3/OgC+//z//P/8/7L/CABCAPP/AQDt/xUAAQAaANT/CgAUAPb/AwAXAPf/CgDz//n/7//s/+v/EgC2//v/"
+     "4//o/zIACgD4/w4AOQB4//z/NAAAABwAzv/1//n/5/+y/wAABwA9AB0ALADi//z/AAAFAPX/6v/s/yQA9/8FAPX/+f/+/+D/"
+     "6v8iACgA7//t/xMAsf8wALz/LAD2/w0Avv8UAPb/DgD4/y8A2/8XAAQA9P8PABYAAgAQAAIA+v8LAPz/JgAFAAsAEwAYAOr/"
+     "JwDo//T/BQDb//n/BwD6//b/6f8WAPn//P/l/9b/JwAzAPv/7v/2/wMA+v8JAP3/7/8CAPz//f8AAPT/BAAAAAQA/P/1//7/"
+     "6/8LAAcA9P8IAPf/EQD3//X/DwD2////AgAEAPX/CwD9/wIA9/8OAPT/CAAAAPr/9/8FAAIADQABAAEA+P8GAPv/AAAFAPn/"
+     "9//8//7/+v/9////DAAGAPb/AAD///b//f/8//z/CwACAAgA9//4//v/BwD///z/BwD9/wkA9v///w0AAgAHAPr/CAAEAAcA"
+     "CQAIAP//CAD5//v/CgD//wMABgAAAP3/AgD8//z/BAACAPj/AQADAAIA//8LAPb//v8FAPv/BgAMAP3/+v8HAPb/+/8GAAEA"
+     "BgD0//f/BgAGAAsA/P8LAA4ABwAJAPT/BAD6//v/+f/z//3/CAD9/wwA/f/6/wkACQD5/wUA9P8BAP7/9f/7//z/+v8KAPf/"
+     "AwD2/wcA/v/1//r/DAD9//f/BAD6//P/9P/x/wcACAAMAPr/9v/z/wAA9v/4//n/+/8AAAkAAAD3/wAADAD1/+n/3f/9//z/"
+     "HADw/wAA4v/0//f/SgDz/wYABgDn/yYA6v/a//X/9v/k/+3/9v8KAOf/CgDe/+X/NQATAP///f/i/6v/+P8GACAA/P/v/+f/"
+     "DQBV/0QAx/+R/xAA1v8vABgA+P/1/wkA4//+/wwAHgAnADgA+/+//0IAGAD1//v/DgDA/7j/BwAYAAUA///w/xsATf8VAAcA"
+     "uP8PAA0AHADp/wcA9v8QAAEAEgDw/xkAAQAWAP//dv/s/+j/+f/p/wAA0f/J//P/+P///wYAxP/8/3v/AQD1/7H/JADT/wsA"
+     "+P/M/+j/6P8UAAgA4P8SAPT/+v8EAAYACAAVAMr//f/a/wcADAD7//v//f/6/97/9//Z/wEA6f/4/xgABwALAPX/+P/W//D/"
+     "/P8BAPT/BQD3/xcADwD3/w4A3v///+n//f8NAAwA/P/4/w4A6/8xAP3/1P8OAO7/5P8CAMP/CwADAMX/8P/y/+r/7v/t/w0A"
+     "+P8DANv//v81AAcAAwDt/wcAz//2/+X//P/9//D/6f/6/+b/+v8UAPf/7v8LAO3/yf/S/+j/6v/1/wUAHwD3/xsA+P/p//D/"
+     "MgAKAAoA///w//v/gv/t//P/4v/7/97/5P8CAAMA2//2/wAAiP/8//L/yP/7/w0A8f8CABsA/v/5//j/7P/8/zIAAgDp//j/"
+     "/f8NABcA9//iAP//9f/j//r/+v////H//f/9/yUA+P/c/9X/6/9DAPf/AABWAAYA8P8DAN7/7P8pAPr/AwDW/+H/+/8DAAEA"
+     "AQD7/zsAIAABAAYA8//u//3/OwD4/wQA8v/O/9T/IwDg/wsAoAD5//j/HADW/wIAAgAHAPr/8P/8/wkAFgD5//X/BQABAL3/"
+     "AAARAOn/0f///zEAAwDz/+3/FADe/yMA3/8KADgADwAuAAkA8f8RAPn/3v/Z//X/OwDv/7n/CQABAPr/GQAAAOf/BAAuAOH/"
+     "DwA3ALn/OwDn/zAACwAnAPb/AAA4AAYA/v8tAIL/9f8HAA8A8P8FAOr/5v8AAOP/+/8IAA0Ax/8NAOL/QADw/+3/DgC3/zQA"
+     "4v/y//b/KAASAAUA3v8YAB8A5P+M/woATAD8//7/7P/3/+//+f8WAB0A/v/9/+D/9//z/zwA+P/4/wkA6P8GAOv/AgD+/wsA"
+     "6//7/wsAEgD1/xgA+P/k/0kACQD9/+z/+//9/wAAAQD6/wwA/P8JAPn/CwD+////+f8NAAYA///+//b/BgD5/wcA//8JAPX/"
+     "9f///w4ACADz//j/AAAHAPT//P8DAPn//f/1//r/AAABAAgAAwD2////BgD8//n/8//1/wIAAQAIAPn//f8HAP//AgABAP3/"
+     "CwD+//j/AgD5//n/+v/8/wsA/v/4//r/+P8LAP7/+/8KAPj//f/4/wYA/v8EAAwACAAIAAQACAAEAAkABwD8//3/AAAFAAMA"
+     "AwACAPf/CwAHAA0ACQD///j/9/8FAAwACQAFAPr/+P8DAPP/DAD4/woABgAJAAoA/f8MAPv/AAD7/w0A+/8LAPv////3//f/"
+     "/P8BAAkA/f8HAAoA+P8CAPT/+P8DAP7/AAD+/wYA/v8AAAYABgD//wMACgAAAPX/BgACAAQAAAD///v/9f8DAAcA/v8XAPT/"
+     "7//1//3//f8CAO3/BQAVAOH/AgAFAAQA/f/x/wIAFwD1/wgA+v/w/wgA9//0//X/0//r//7/CAD8/+H/HgACAPD/9P8OAPL/"
+     "5f/q/9H/IQD2/+L/9v/1/wIA9f8RAAQA+P8KAPz/0f80APL/+//u/9L/wv/o/x0A3v/P/ygA6v/+/9D/RwAbAGv/1v/S/yUA"
+     "zf8OAOD//f8UAPj/HwA0AOn/BgAlALr/NwAcAAIAFwDy/8z/2v/+/wIAEgD7/wAA7f+3/zMACwBo/ykA0/8jABIACADX/zAA"
+     "3f/4//b/JQDx/0EA7//z/ywA9f/o/+X/KAC+/x8A+P/4/wAA9v8NAO7/Lv/5//r/6f8DAAcAAADn/wAADQArAAEADQAWABAA"
+     "6v8NAN///v/2/7n/+/8YAAAA9//Q/wgA+v8FAAgABQD//+3/BgAHAO//GAAAAAoA2v/7/wcAMQADAHn/7/8QAOv/DgDx//z/"
+     "EgD7/xAA8v/4/xgACQD5////AQD8/6D/BQDW//b/8P/M//j/w/8IAOb/z//K/yIA6/8EAOz/DADk/xoA9P8DABIABwD4//P/"
+     "4/8m/7L//P/0/wMAEgDn//v/BwACAPz//P8fAC8AAQD5/+n/7/86APP/BwDn/w4A//8JAOP///8YAP7/8P/7//P/9f9DAPj/"
+     "9P8EAPT/7P8EAOz/DADx/wEAIgAKAPr/AADs//H/JgDL/wUADgD5/wEAAwDh/wEAHAAQAO//CQDL/w4A1P/5/wAAnP/2/9v/"
+     "AwAJAPv/FQD0/x0ABAAKAOz/yP/2/0IA3v8BAIUADQD7/xAAwf/+/xEABgABAAEACgDq//P/BgDnAPf/9//J//3/BgADAPD/"
+     "9/9CAOX/BwDo//L/7v8kAN3/BwBbAPr/+/8UAMf///8OAAUA+P9nABoA9v/I//b/8v8DADEAEgD6/wUABgDU/wgANwD1/wgA"
+     "7P8NAPT/KgDd/wQAXwD3/wAADgDo/wkA///3/wAA9f8xAOj/EwDl/wUA///7//3/+//0/xMA6P/5/xwAEABOAMv/9P/z/yMA"
+     "4P8NAP3/MgArACMAlP/z/x8A///q//f/8f8WAN//CgAOALr/AQDZ/wUAAwBWAN3/+f/v/+L/NQCw//z/AAD//wAA9//L/xoA"
+     "GwBAALT/DgA8AB8A9f/y//P/CADr/woABgD7/zEA5f/1/+n/IgDk//j/+f/d//T/zP/6/wMA+v8DAO//DgAtABoAKQDe/wIA"
+     "KwAFAOr//////wYA8v8HAPX/9P/3//f/+f/9/xUA+f/3//3/8P8YAP7/AAD0/w4A8/8MAAwA+/8CAAYA+P/8/xUA+v/w//n/"
+     "/P/2/wEABAACAPn/AwD6/wUAAQD8/wYACQD3/wUA9f/+//3/AAD7/wMADAD+/wkA+v8MAPb//f///wgAAQACAPb/CAD9/wEA"
+     "CQD+/wsA9f8GAAIACgAFAAkA+v8LAPb/CQADAPn///////X/9f/1/wUACwAHAAMACwD5////BAD5/wcA+v/4//j/9/8AAPv/"
+     "DAD//wsA9v8DAP//BgD5//z/AwAJAPb//v8FAPn/AAD7//7//v8EAPb/9P8AAAcAAgD6/wkA9f/7//7/9P/0//X//f8BAPz/"
+     "/f///wMA+v8CAPf/CwAJAAAADAAAAAoABwANAAIA9f8BAAMAAgAMAPT/+/8GAPX/AgD7//P/BQD9/wQACwAGAAcACQD1//z/"
+     "BgD9/wAA9v/p/wsAAQD8/wkA9v8EAPL/CAD5/wkA/v/3/9L/7f8OAAcA4f8MAP//8//f/yoA9v/H/w4A2v8dANf//P///w8A"
+     "7//u//7/CQADAAUA6//X/zYA6v/9//z/3f+l/wMACAAEAOn/IgDt/xAAx/8UAPT/Xf8FAOn/OAAHAPX/AAAAAPn/FQAuABMA"
+     "DgBEAPX/CwArAAwAAQADALL/r/8OABEA8f/u//X/0f/0/0T/KwDl/yEA/P/m/wgANgC7/wQACAAbAPX/FgAuAOn/MQD9/+X/"
+     "+P+P/xEA7P/R//X/2v/s/wkABQDQ/7b/BADV/xAA7v/f//z//P8QAA4AGwDY/yAA/f8///L//P/r/wkACgAKAAkADAANAAcA"
+     "7//K/7n/BAD6//z/3/8PAAgA1//9/wQA4v8bAPX/BQCs/xsAX/8CAN//BQD+/wYA5f8UAAgACQD6//j/CAD7//n/FwAcABIA"
+     "9//9/wUABgAOAEz/9f8gANT/QwALABAA5//2/7P/AQDN/wYA6v8DAPL/CwD0/wgACQAEABIA4P/7/2H/8f/p/wIA/v/4/wIA"
+     "CAD//wQA8f8AACIAdf8LAPL/uP+d/wIACQAKAPT/EgDr/xAA9f/7/xAACwANALn/AQAKAM//9f/x/wIA7//h/wX///8GAJ7/"
+     "+f8RAAoADADW/xYAzf8VAPn/AQAPAAYA/v8ZAAwAAAABAPz/DwDZ/wQA6f/z/wcA7v/+//L/EAAJAAQADADM/+r/KwDe/+7/"
+     "qv/0/83/GADt/wgAVAD5//r/EgD4/w4AFgD+//n//v8LAPz/KwAOAPb/gf/2/wUADgAGAAAA2f/6/ywABwAWAPP/GAD3/ykA"
+     "6/8FAFoAAAAGAA8A0P8VAA0ABAAOABEA6//+/9v/6P87APr/CwDy//v/AgD///b/CQBIAPD/9//0/xQAAQApAPD/CAA7AAQA"
+     "6f8LAI//9f8SAAIACAB0/+n/AwC5//P/8P8HAD0A5f/u/wMAJAC0/yEACAAcACsACgD0/wcABQC3/wgASAAlAOr/AQDX/8//"
+     "EgAGAAkA9P/0/+j/+v8LAPn/8f8cAOP///8FAFYA6P8dAB4A4f8XAMP/GgD9//T/yf/y/+b/EwD8/zIAev8UAEIA+v8YAAkA"
+     "5P/8//j/+v8oANf/AADu////+v8XAOH/BgAMAOL/EQDH/w0AAgADAOb/8P8FAA4AEwAtAOD/8/9BAPT/BwAAAAEA9f8HAA8A"
+     "CQD1//3/8/8GAAMADwACAPr/CQAGAPf/AQAGAP7/+/8LAPz//P8AAAIABgD2//P/AwD8//L/BQD3/wIA+P8HAAcAAwAFAAQA"
+     "9P/8//X/BwD4//z/BAAKAPb/DQABAPz/BQD0//v/DAD1//z/+P/6/wMA/P/4/wwAAQD+//3/+P/5////9v8EAPv/9v8DAPn/"
+     "CgD5/wQADAD3/wkACwD1/wIACwD+//7/CgACAPn/CQABAAIA9f8EAAMA+v/5//X/9//1/wcAAQD3//z/9f/9/wgA+P8CAAIA"
+     "+/8KAAIA/P8HAAUA+f/1//z/CgAGAAEAAgD6/wEACgAJAAsA9P/+/wcA//8AAAAA/v/3//P/BwALAPz/CgD6/woA/f/7////"
+     "+f/9/wYACgALAP3/AAD8/wcACQD4//X///8QAPj///8AAPz/8f8AAPf/+v8LAPb//f8FAAMABgD9//H/9v8DAAYA+P8HAAUA"
+     "AQAIAP3/9v/1//v/+f/z/9L/y//4/wUACQDv/xMA3f/8/+z/HgD3/8L/BwDW/xcA6f8ZAPr/BwAEAPv/FwAfAB4AHQDn//z/"
+     "JgD7/wsA9//x/6z/DAAUAAMAFgD7/9r/3v9o/zwA///3/wgA8v8dAAQA5//k//D//v8OABgABQAgACoA+f/p/zYADQAYAPX/"
+     "9v/r//T/4P/w//z/DgDD//v/V/8oAAIA8v8pAP//8//J/wgA7f8OACIAAv/l/zIABgAVALz/7f/t/zsA+/8IALr/jv8VAAYA"
+     "6f8JAPz/8f8UAJn/KQD3/wcAAwDz/xUArP/E/3L/FgDT/wMA4f8TAOT/3v/2//f/7/8DABUAAADO//T//v8iAPr/AgDn/8X/"
+     "5P+t/y4AuP/3/zoA7P8CAPj/5v99/yMAvv/5/+n/CwD0/zwADwD8/xMAEQDs//b/JgD0/6z/6/8DAAsAAQDR//n/P/8XALD/"
+     "/f8HAOP/FwC2//D/tv8aABIAFADg/yoA7f8mAIr/CgDx/wMA+/8UAD4AXv/z//X/9v8BAPX/+//9/yIAKAD8/wgABADy/xgA"
+     "LAAdAGH/5v/3/xIAGQAoAPP/IADc/wwAvP/+/wwAHQD7/+7/1f/m/+P/HQDs//D/JQDg/xUAmf8LAAcAEwASAPb/EQBr/wAA"
+     "9v8NABMAOQDa/w8A5v/0/6T/+f8VAPD/BgCO/+r/9P8IAPD/+P/R//r/+f8aALv/BQA8AM7/NADn/ywAuf/+/93/AQA8AAYA"
+     "7v8qAK3/BADg/xgA7/8TAPb/uP+2/wsABgDn//n/2//r//7/SwDe/+r/JQD3/y8Awv8BAIX/LAARAP//JwAcAO7/HADe/+7/"
+     "5v/v/yQA6P/v/xAAFwADAPH/Av8BAP//CAD0/yYAu//o//f/BwDP/+v//v/8/xwADgD6/1UAFAD9/wQA0//7//7/HwAAAOf/"
+     "AAABAPX/6P8TABYAJQD//wcACQAYANT/2/8WAO7/DAC2/wMAEQBHAPX/6P8aAPD/AQDu/37/9v/x/xgAAQABAAAA6/8CAP3/"
+     "+f/c/+//6//y/wsACwCj////FwD3/w4ADQD5//H/7//J//3/9v84ADAATAAMAA4ANQDy/xMA8v/j/+n/AgAKAPf/9P8IANr/"
+     "8//8/xMA3f/x/wcA3/8kANH/IQDx/wEA4//4//v/BQAUABgAzv/4/yIA+P8BAAAA8/8JAAgA+f/6/w4ABAAMAAUA9//6/w0A"
+     "/v8KAAEAAgD9//r/DAAGAP3/DgD9/wMACgAKAP7/BwD3//X/AAD7//j/9P8BAAgA/P8NAPr//P/7//3//f/4/wAACQADAAIA"
+     "/v8EAPz/DAD6//j/AwD3/wMAAQAGAPn/AAD9/wQADAAHAP7/CQAMAAIAAQD5//T/9P/5/wYACQACAAcA9/8DAP3/BQAFAAQA"
+     "/v8JAPf/CgALAAgA9//3//j/BAD//wcACQABAAYACgAIAAEACgAFAPv/+f8LAP3/9P/7//j/+P8KAPb/AAAFAAgA9//5/wIA"
+     "/f/1/wkA+v/9//b/BQD7//j/AgD+/wMACgD2/wgA9f8BAAsA9f/0/wwABgAGAA0A+P8GAAQA9v8GAP7/+P/0//3//f8MAAcA"
+     "BAD6//X//v/8//z/+//8//3//v/5//j/9f/w/wUABwD6/w0ACAD0/wUADgD1/wYACQD1/wQABQD5//j/CgAEAPf/AQD+/wIA"
+     "/v/l//P/CwAOAO7/CwDq/wIA0P8AAPj/CQALAP//BQD//+//9f/2//z/6v8OAPj/+P8GAPv//P8vAPD//f/0//f/AwADABQA"
+     "CwD7//v/8f/u/6z/JAD///7/6P/e/xoA2f/u//v/BAD///X///8hAOz/CgDr/wgALgD9/w0AAADL/3n/8v/4/wkAAQANAPf/"
+     "8f/T/x4AFgADABUAEgAfAKr//P+p/wYA5v8WAPX/KgAbAFQA+//n/1EABgD9/+v/3v/J/+v/GwAKAK7/BgDH//v/w/9WALb/"
+     "AgAeAO3/NgDs/97/o//6/+v/CgAZAAYADQAaAMn/8v8ZAAQACQAGANX/+P/3/xQAAgDN/yIAy//x/73/PQDC/wEA///k/ygA"
+     "s//h/7n/EgD+//L/+f9JAO3/BQCR//P/PQD//xEACQDR/8n/8//4/+f/3v/w/w8ACgBn/z8Azf/s/wQA4v8hAKj/7v/v//z/"
+     "GQAEAOj/JwAiAAgAqP/i/ykAGgDy//7/JwCS/+3//f8KAAUA/P/n//X/6f9CAOD/CAAZAPT/JAAOAAMA1/8MANn/CQDZ/wwA"
+     "7v8aAL//EgDQ/xsACgDv/ysA4v/j//r/9P/e//z/5P/l/8L/6f/X/wUANQD5/xsAAwANAKX/OAAXAO//8v8nAPz/MwC6//n/"
+     "7f8YAOL/BwDM//v/6/8VAPz/CQAAAA4A9P+F/zUA7v8TAP7/6/8qANn/9//U/x4A+v/+/9D/UAD6//T/i/8FACsA9P/o//X/"
+     "CwC//+r/CAARAAwACQDU//f/7v8wAOv/7v8NAO7/GAC6/ycAh//n/93/DwDo//7/GQBIAJ///f8zABYA+v8KANv/of/s//7/"
+     "DwDz/0gACgDf/wIA+//n/wYABAAKACQAlv8EALX/9f8AAAUABAAlABwAKQCU/ysAGgADAA8A4//5//3/6/8XAP7/vP8DAPD/"
+     "//8MADoAzP8aAPL//f8oAOv/AADu//j/8P8DAO3/PgAhAAUA3P8IAEEA8f////P/BAADAPP/FAAFAPz/FgDp//7/AwAgAN3/"
+     "/P/s//f/FADZ//P/9v8FAPz/CgDo/x0AEQAFALb/FAAyAPr//P/t/wEABQD0/wkAEADu//7/8f8BAPT/LgDw/wYAAwAFAAIA"
+     "/P/1/wQA+//v//n/BAAAAP7/BgAGAAUAIwAIAAYA/v8CAP3/9f8BAPr/CwAMAAAADAABAAAAAAD4/wEAAAAIAP3/BAD///r/"
+     "/v8DAP3/CgABAAQAAAAIAAAA/P8FAPz//f8HAP7/AAD5/wcA9P8FAP3/+v8EAPT/CAAEAPz/AAD+/wcAAwAAAPf/9//5//z/"
+     "8//5//j/+P8IAAoA///4/wIA/f8MAPz//v8LAPz/CAAAAPj/CQD4//3/AwD4/wsAAgD4/wgACQAMAP7////2//7/9f8IAAkA"
+     "BwD2/wUA+/8NAAAAAQD5//z/BAAFAPj/CgD2/wYADQD5////AAAEAP7/DAAFAAUA+f8EAAIA9P8EAPb/AgAFAAAACQAHAAMA"
+     "BAD5/wQA//8EAPz//v8GAPr/+//6/wgABwAHAAMAAAD2/wgABwALAAMAAgACAPn/9P8FAAYA9/8MAPT/BAD5//j/CQABAAcA"
+     "+v8LAPj//v/9////DAACAPn//v8DAAgA9f/1//v/BQAFAPv/AgD5//r/9v8IAPb/BAD+/wEAAAD0//H//f8AAAEA//8EAAEA"
+     "/P/6/wYAAQDu//P/AQAJAOr/AwD1//P/+f8JAA8ADQD8//v/AgAJABIACgD7//v/5f/e//T/DQADAPL/9P/u//L/AQAbAPn/"
+     "///8//r//v/a/wEA3v8FAP7/9/8NABMAFAASAPv/AAAlAPf/+//8/93/9/8AABMAAQDk/yEA7f/3/+z/IADo/+b//P/4/xoA"
+     "9f8EANv/+P/u/wMALgATAP7/DADr//r/LgD+/wYA8//h/77/7v8wAAEA3P8ZAPz/9//W/ykA9P8DABwA7v8xALj/EADK//v/"
+     "9f/7/xcAIgAJAAEAyP/u/z0A9/8YAP7/3P/z/+b/FQDz/8L/CgDc//3/0/8RAPH/8/8BAOr/HwDi//H//v/5//L//P8HADsA"
+     "DQAWAMz/+f86AAYAAQD9/+b/2//3/wsAAgDb//j/3P8EAO//CgDy/wIA9/8JABYA5v/U//n/AQDy/+z/BABDAAgALwDZ//f/"
+     "GwAFAAQA7v/l/9L//f/7/xgA7/8AAOb/BAD8/ycA+P8EAO7//f/8//n//f/U/wEABwADAPL///8VAAMA1P8RADcACAAKAAUA"
+     "CwDg//X/DAD9////AAD1/wYADADy/+7/9//0/wYABgDU/wkA5//2//3/8f8YAPz/CQD3/9f/EwAnACIABAD7/+D/7f/1/wsA"
+     "GwDU/wwA+v/t////IgD//+f/CwD9/yEA2P/7/wAACwDz//n/DAAWAPz/DQDv/+b/IwD1//7/AwDj/6r/8f82APb/4v/c/9j/"
+     "/P8BAAEA+v8BAOz//v8WAMr/5P/t/wQA8P8CAP//NQANABkA4P/2/0wA/v8NAA4A9v/W/wEAGQA1AOD/GgDc//D/9v8vAOb/"
+     "6P8CAP//IwDs/xQA0v8PAP3/9v8LACcAFQAnAL7/DQAdAP//AQDw/+j/2P/0/w0AAgDx/wwA2//6//b/GwDr//b/AQDy/wAA"
+     "sf8LAOf////t//X/CgAqAAoAJADi//n/IAD0/woA+f/z//3/BAAEAPj/6f///+X/BQD2/xcA+f8AAAoA+P8XAPD/8f8EAAMA"
+     "9//1/wcABgAEABcA7f/6/wwA8P/1/wcA/v/3/wYADgAEAOz/CwD+/+//CgD4/+//AAABAPn/+v/3/wcABwD///T/+P8JAAUA"
+     "DQAQAAYA9v8aAPf/CwAHAPP/+P8BAPj/+P/4/woA9P8DAAQAAgD3/woACwD7//r/BAD8/wQA/f/6/wAA9/8PAPj/DQABAPf/"
+     "AAD6/wYABQAFAPz/AAAJAAIAAgAIAPT//v8IAAoA9v/4/wAA+v8GAP3/AgAKAAwAAwD1/wAABwALAP//CAD9////BwAEAAoA"
+     "/P/0/wsACQALAAUABgD5/wYABgD5//X//f8JAAcAAQD7//7/9P8IAAkA+v8JAAcAAQD+//X//P/4/wkAAwD7/wAA+f8BAP3/"
+     "BwD4/wAA+P8FAAkA/v/3//X/CAABAAgAAwD4//j/9v/8/wQA+//2/wsA+//9////9v8DAAAA9f8CAAYA9f8KAAsADAD//wYA"
+     "+P8JAPb/9f8EAAsAAAD0//j/+//3//X/9//0//X/+v8EAAcA+f/1/wUACQD4//n/BwD3//r/CQD//wEA9f8DAPX/AwD7//T/"
+     "9v/5//f/9//9//r/CAAGAPT/AQD1/wcADAALAAMA+f/2/wgA9v/7/wMA//8FAAgA9//6/wAACAAEAPv/AQACAPv//v/1////"
+     "AwD4////BAAFAAcA9P8GAP//+//9/wkA+P8GAAgA9P/y/woA9f/z/w8A///4//P////9//3/9f8AAPb/CAD1//7/CwAHAAYA"
+     "CAAGAP3/CAD6/wkA+//9//b/BQD0//f/9f8CAAQA+f/3//T/+f/6/wYAAwD+/wcA/P8EAPv/AQAEAAMA///7//n/CgD2/wUA"
+     "BgAAAAoAAQAOAPb/CgDz/wcADQD0/wAA8/8NAAcAAwACAPv/CQAFAPv////z/wMABAD6//X/CAABAAYA9f8MAAwACgDr//T/"
+     "CwD9//3/+//5//P/BQAAAPv/+P8SAPb/+P/6/wUA8v8HAAIAAQADAO7/DwD/////9f/w/wAACQAEABMA/P/4/wwA+P/z//X/"
+     "9//1/wMACwD6//f/+P////r/DQAFAPb/BwACAPX/CgD0//b/CQAJAP7/8v8FAAcADgD5//7/CQABAAAA///x//b/+v/2//r/"
+     "AAALAPv//v8EAPn/DAD+//r/CQD5/xAA9P8AAP3/+/8NAPX//f/7////AQD3/wMA+/8EAAEABAD///D/8//5//P/+P8EAPn/"
+     "9v/+/wQA+f8JAPz/AAAAAPn//f/8//z/9P/7/wIACgAQAA8A//8BAPz/9f8KAPv/9//+/wcADQD8/wsAEAD8//b/9/8OAAcA"
+     "DQD6//n/+P/6/+j/AQAFAPf/+P/3/wUAAgABAPr////9/+//CQAIAO//+P/6/wkABgDi/xIA+f8HAO//BgACAPL/BQD6/wsA"
+     "/f8RAPn/CwAOAAYACgANAAoA+v///xQACQDt/wIA/f/t//X/+P/7/wsA+/////v//v/x/woA9//x/wMABwD2////CQANAAAA"
+     "+P8DAPb/EQD+////BgDw/xEA8v8GAPv/BwAIAAwABAADAAcA//8IAAAADAD5/wIACwD5//7/+v8HAAUACwAJAAcA//8EAAEA"
+     "+f8JAAEAAgD2//P/9v8DAAgA9v8FAPT/9v/+/wMADAALAPn//P8LAAQAAQD3/w0AAgAGAP//BQD0/wcA+v8DAAIACQALAPv/"
+     "+v/+//v/AAD//wcAAQD6//n/9P8GAPf/9P8DAAMA9P/8/wsAAwD+/wUACQD7/wwA/P8AAPr/CQD6/wIACAD6//z///8LAPT/"
+     "CAAFAPr/+P/7/wkA9P8MAPf/CwD9//X/CAAHAPv/DAD4//3/9v8LAP3//v8DAPf/+P/2//3/DAALAP//BwD5/wYABwD6/wgA"
+     "AAD9//v/9v8GAAcA9P8IAP3/AwD7/wsA+P8CAAUACwD6/wUACAAGAP///P/4/w0ABAADAP7//f8HAPT/+v/6//T/CAAJAPr/"
+     "///9//T/DAD6//z/AwD8/woACwAIAP//AAAKAAkAAAD0/woA9v/4//b//v/1/wEA9f8GAPP//v8DAAwA+f/7//n/+f/+//z/"
+     "///2/wsABAD4//X/BAAAAPb/BAAHAPj/AQDz/wAABwAFAP7/+v8BAP//BAD5//n/CwDz//X//f8AAPj/CgAEAPT/+P/5/wAA"
+     "+f/9//X/BAAAAPr/9v8HAAMAAgD8/wkAAQD3/woA+P/1/wYADAD7//3/CQD9/wgA9P/7/wMABgD///P/+v/5////AAABAPz/"
+     "AQD+/wYAAgACAAMA+P/1/wIA/f/9//b/+P8HAPf/AwAIAAEACwABAAwA///1/wsA/f/2/wcA+/8AAPn///8AAAcABgANAP7/"
+     "+//+/woABgABAAEA+P/7//z//f8KAPz//P/5/wEA+P8KAPz//P8EAAYA9/8IAPv/AAD0/wwA+//1/wUA9f/3/wsA/v/1/wgA"
+     "///+/wgA+P8EAPj//f8JAP7//P8CAPT/8/8BAAYA9P8LAP3/BQAJAAAABwAMAAwA9v/2/wgACQD5//z/AQAIAAYA///5//b/"
+     "8f/3//7/9//3/wUAAwD5/wwA//8KAAoA9f/6/wgA/P/0//z/9P8BAAcABQAJAPv///8MAPr/+P/1//X/+v/3/wgABwAAAPv/"
+     "AgD2/wkACAACAPn/+v8LAAoAAgD5/wsA8v8CAAoAAAAJAAYA/P8BAAAACAAGAPz/AgAMAP//CADy/wQABAACAAIA+//6/wQA"
+     "DAAAAPv/BgABAPj/CgD0/wEABQAMAAYA9f8JAAMABwADAPr//f8DAAgA/P/3/wkADgD7/wEABQAGAAUA+f/5/wgACQALAAAA"
+     "/v8DAPX/9P8DAAUACQD4/wAA+f8BAPT/CQACAPz/9P/6/w0A+f/9//f/BAD4/w0ADAD9/wkA9P/+/wsAAwD4/xUABgACAAgA"
+     "/P8FAAkA9P/3//f/CAACAAEACgD4//f/9f/6//n//P/9//z/CwADAPn/CQDx/wIAAAAHAPr/9v8EAAkAAwD6//X/+P8LAPf/"
+     "+f8IAAoAAAALAAYABQD1/wcABAD2//z//P/8//v//f/8//b/9f8IAAEA9v/3/wQA9P8MAPf/BgABAAAA+P8KAA4AAAD+////"
+     "9f8AAAsABQD8//T/BgAAAAkA/P8LAP3/BQAGAAYACAACAPv/+//4//7/9v8GAAUABwAJAPr/CQD2//r////9/wMA9P/3//r/"
+     "BwAAAP7/+P8FAAoA9//3/wQA9P8IAPn/AAAHAAEA+v8AAPT/+//0//v/+P8HAAYACQD+//z//v8HAPv/CgD5/wUAAADy//7/"
+     "/f8EAAgACwAKAPX/+f///wsAAAABAAgABgD+/wsAAQD5//n/CwD3/wYA/v/6//r/CwD+/wUA/P8KAAQAAwALAPz//v8CAAUA"
+     "+v8CAAUA9P8GAAIADAAKAP//BQD6/wsAAwACAAcA9/8MAAwACwAHAPv/+/8NAP3/9//9/woAAwD///T/9//3/wMACwD0//T/"
+     "//8KAPX//v/7/wgA+P/1//f//P/0/wcADQALAPr/BgAIAAUA9/8FAAIA9v/6//b/BgD9/woACwAFAAcABAAGAPz/BgABAAIA"
+     "BQAGAP7/AAADAPT/+P/0//P/BQABAPf/+/8FAAIAAQAEAPj/CwD3/wAAAgD8/wQA+f/7//v/AQD+//z/+f/0//n//P8AAAcA"
+     "BQD6//r/CAAGAP7/AwD4/wwABQD6//7/BwADAPv/+//8//X/BQAAAAwACQD+/wkA/P8FAAsA+P8CAAEABgAHAAEADAD3//v/"
+     "/v/5/wAA/f/9/wEA+v8GAAUAAgD9/w0A/P/9/wsAAwAAAP7/DAAJAAcA///8//r/BwAFAAQA9v////f/+v8HAAIACwD///r/"
+     "/f8EAPT/+/8MAAQABQAMAAIAAwD1//3/DQACAPj/AwAFAAAABwAFAP///v8DAP//BgABAAIA+f8KAAsAAQACAPz/DAAJAAAA"
+     "+f8HAAgAAAD4/wkAAwALAAIAAgAJAPv/AQD3//7/+f8CAPf/BQD3//r/DAAAAP7/BwAHAAsAAQD9/wYA+v8AAPT/9P/1//3/"
+     "/f/0/wMA+v/+/wgACgANAA0A+P8HAPz/9P8CAAIACQAGAPT/CQAMAPX/CwAFAPf/DQD9/wgA9P8DAAUABgAMAP3/CAD9/wkA"
+     "DAD+//3/9P/+/wkAAAD4//r/AQD///r/9//5/wIA//8IAPv/BgAGAP7/+f/+/wMA///5//T/CQAIAAIA+f/8//T/+f8FAAEA"
+     "9/8AAPX/+f/z//z//v8BAPn/+v8AAPr/CAD8/wsABAD7/wQAAgANAPz/AwD///3/AQD9////+//4/woABQAEAAoA//8EAAkA"
+     "9f8AAP//AQD///z//f/5/wIACAABAPX/+f/4//v/+P/0/wMA+v/3/woA+//+/woAAwD1/wQACgD//wUA///7//X/BAAMAAEA"
+     "CQD7/w0ACAAIAP7/CwAMAPz/+v8HAAQA/v8CAAAADAAIAAMA9f8FAAgACAD2/wkA+v8JAPz/AQD8/wwACAD+/wsABAD7/wcA"
+     "/P/1//z/DAAMAAkADAD9//f/BQADAP//AgAHAAUA9//9//r/BAD0//P/CQAJAP//+P/2/wkABAD0/wgADAAAAAoA/v/3//v/"
+     "AwAEAPj////+/wUA/v/1//v/+f/0//3//v/7/wUA+P8CAPr/BAAFAAwA+//1//3/CQD2/wEA9P/4/wwABgAIAAkA/P8JAP3/"
+     "+/8IAP//BAAKAP7/+/8DAPv/AQD9//n/AQAAAPP/CAD2/wEAAAD+//j/+v8DAP7/9v8GAAkA9P8HAP7/BAAGAAkABQAIAAMA"
+     "BQAAAP7/9f/0//j/+f/7//3/CAAGAAIA9f/8/woAAAD9/wgABgADAAgAAwAGAAkA+P/2/wcAAAAEAAwABAD0/wEAAwAKAAIA"
+     "9//0/wMA/f8CAAAA+v8JAAUA9/8BAAAA/P8KAPX/9f8HAPb/BQANAAAA9//+/wgAAgD1//f/+v8JAPX/AQD1/wgA/P8JAPv/"
+     "AQD7//b/9P/2//b/CQD9/wcA///+/wUABwD9//j/+//8/wgABwABAPT/AAD//wkA/P/5/wsA9f8IAAkA+P/+/wAA8/8MAPj/"
+     "+P/2//f///8EAPP/9f8EAP7/9P8AAP//CQANAPf/CgD3/wYA+P/3/wAABQD8//j//f/6/wsA+f/0/wYAAQD2/wYADAAMAPX/"
+     "CgD///z/BgADAAEABwAGAAQA/P8LAAEABgAMAAcA+v8JAPz/AQD7//r/AQAGAAQADAD1//z/CAD3/wcACAAKAP3/AgD6/wIA"
+     "9P///wUA9f8GAAEA+P8JAAkA+P/5/wsAAAADAAsACQADAAUACAACAPX/9f////n/BwD+/wQACgAFAPz/BQABAAwA/v/0/wQA"
+     "+v/9/wcACgD//wMAAQABAIP/if9RAK39d/0N/oz/EQBZ/j7/XgCQ/2D/8f8hADMACwDq/17/NP+g/3z9VP82AGD/NgDQ/4D/"
+     "TwAQ/2r/YP8B+/gK6Pb4B/oLAP309Bz6B/L76vMD/NgF6REtCPT2MQb//wNw9/j7DfQABv0CCgACBQAKDwH/APoAARD09gbJ"
+     "A/TiBPfvEvj62hAF6STtD/cX5QzY8hgRHhT74wHO4P0LEwPu/P3YFA0K5gb9BRPpC9kDBg//5frm5BYL5wcWAP8NA//8+QDz"
+     "Cvry+g3t+/wA8vQFB/gR/QIIEPYE+gYJ9fjz7hDt9Qvu8AkD/fb0DQXw/Aru7ATv7QPv++z4AfcQCPruDAwJ7v7//vkM7QEF"
+     "9fPy+Azy+Qrx9Qv99QIL9v4TCQcACgj6/Rj5/f8C7vf67/gJB/b6+PPs9Bb+7PX8+PX2BALzE/QH6Av/4wX9CvAV/wf5+vUD"
+     "Ew3g7RMJ4P39DwL2+vTuCCH17foiJRrs9ejdCfj14PLw1vcz3fQeAgMJ+xdm+PP4AvP5Av0EAAL9APkG+gjx/v379f0A/ATj"
+     "+fr28/HzBvwJ8v8G+vAD+/34/O/8APzp/O8GBwD49BTpLwbyAjIF+Q/03R336vjoEwEp/BXsGOoI6ygB/eLjDAAL30ARBSsF"
+     "CQkE8woS7AX7/wECAPg1///8BfkM//0JA/8KBP30+f8U6+YC8BEQ8h/66uwk8fvxAvIaNPT3IgD7+O4WKvMJ+wTrCf75EvcA"
+     "+hj9G/38/v4zBv7+Ee74+P0A4DAw8xbvBfsF9AQQ+AXy//kKAO4e9TcJ9wAq7uTqBf0L+vYvA/YM+M8JBwoN3BgF++4j8vLX"
+     "+94mMewKEwoG/v3/8FUGAfP29gkP5QPn9QPy//r+BAfoCPD2Aej2/Pvy6/Dt8fEM+fb+8vjl9f34/v/yAg/4AQL8AQQN+gAI"
+     "EAkR0dQe7BEoKPcHFvoM+wsDE+4WMe733foVHu4HEgzv7/oeFscT+9XTGPHk/PkS/fbv+emjFhQXE/PdHvXj8ggcCwYDLwIN"
+     "ZSTPExwLEq0aBBnaEWcK4wO3FiQYKBoC7gTCY/AFHcYFCg/9Cf/dFAEKB8wJDCEOHQwDCAMD///97gYD/vkGDfT4++gE9PAE"
+     "8fsD+QgF/P4W9gX+8Pbr9CkTB/sC+Ab5AewC+gL3/fv79gT29gAD+/D8CPHtAAz++/Pc+PTu+AAO9wH9AP79/gj28wIE9gD5"
+     "LAD09O7z8eUD+P/y+wL/BPY34/Lm+An57Q34+RX3/+XmCBIO/RfuA+cb+P0TNAb8OB/39Q3u/9kAEAsSAD4C/Qfs8fICIwsQ"
+     "9AnoM+r8+u33+gH+A+7k/frbEfH9Bg0C8/kABxYMBgryA+P/3fTw0+wOCQsB/uX42un29vv4+Qwk//76+gEC9RIQBfAE9QP+"
+     "IifV+RTqAekfCCEDHzz//AvcDOcDKPoN5vnnIQT66unhAAD1+fTg/AHoCez4+PoFFAL46y4A+wj+Gf8BBDb3Awkm6ukvAALg"
+     "BA4DDfRa7esD5/v3+BsED/Lo5Q3j6h/56ecC8PYG7A37AvQE4/k+CO0F9u3+8/n/GRj/9+M7Agz5J+kVEvsQ9RzyJQgRU/Xt"
+     "2O4rK9/t7PTwA9/c4PIfzAcEA/wF7d4HAfT5BAH5KQUpAvgJBQsB/vMHAQQJ4gUEQDbSBBYJB9YMCvHrGEIN1Qjj9Rn/KC4G"
+     "8QzJNd31HMEPERIGBwLgFQcEDtgGCiUTIBMEDfAMC/gPIBEPASIFDTAKvBIlEBe6Iv8e5xDpEcwaxhEhFzEgDBwe/APzBA4Q"
+     "/jrfC/TpDuYiCi0GD0j/5gTtCv0BAe8K+fLj8vD7F+r5CgT/BP3wB+r/6PH5Cy0N+AcK/PQE/PkLJQgQE0cICVDvvQ8tEhG/"
+     "If4X6RUBFNMhzxU4CC4qGPgJyzjb/yzPFSIMCA754AwA/gvkBgUyCC4KBRcBDQ/4EBUE8O4f+A0jC+wQHw0T9g3WCBoFDurz"
+     "2+gXLvDqDO/98egI5Pci9PHuCQDnEfYL+Av2BOAPKQwRD/LnFPX3AP0B10zj+/gA+fj7/P7y8gH9/fv3+vn6/PH9/gT9A/kB"
+     "Avv1AgNj8/5b8gUFBfL1zeoF8fn4UP4O+MX28/jnFPv/7AkCAAD2+gdK0/Ik+RLj9wf//S4YBNgC8gHwC0TsAPYJ1vAl8frE"
+     "+QwJBQj26vr99v3/BQv5BEwF/g/+8gTX9RH/4OgZ7PYzEwUGEPj5/wQPCe0ONdf+6P0CFQEUEwro+gUqLdgS+eDU+/zl8Pr3"
+     "9eXj+fvfEf4c+uXaFvjh+fwAEPdY+Pn7APL9+fL9//j9CP8HBfkNBPP/9Ab15/3OA/L79/0C/Qf+AAv1+/UVAwX7+vjx+vvr"
+     "AeoUJADv+yj89u8K+P0CCgILBQQE8O349voC7g/0CALz7fnwBPTx8/M0+fIK9PACAufs+fH6+9vvCw377u/78gEA9ff76Qso"
+     "6wELICvuCwHy5P344fj++QTR4wrz4A8ACvj44R/76fP9/v37Cw3r9yUSDAf+8/YFBQ8O/Q4f6Ab1AvsN9P4YAfTnA/zt9vsL"
+     "DgIKBunxBAj7A/gK72n19QoF/QIG6vgR+wwG/EkD//n1/QT0+/PvDP3s/vHv+vED+AP5+Qf8Cff4//z9EPj/yur4AAXp9v/6"
+     "Be4D+O8L/v/u+vf+/gz87/ID/PX0Bfv9Bfj69CH9A/n5AfAEIPIABfQBBeALNPD7AwPCSPcVOv3/DgnnAQjrBPL/Bvj78Sv9"
+     "AgIBDAMH+v/3IAkO7iMMBCEU3if18f3YFAMxBAMpDd0G1yQE+N/nC53X//8h7///VPT//zz1///A7v//o+P//4Xv//8N8///"
+     "jPX//yv1//98DgAACeX//+4CAADX+P//Fff//6/5///h9///Ufv//8L7//8T7P//Ye///5zr//9Y9P//KvT//2Tp//8TBwAA"
+     "Heb//x3t//9V/f//HO7//xz1//9i7P//eOoCB+rHGxDuQhhP9dwg6uro59ceKBnFPBvGv+g60+WE+P//"},
+};
+
+const int NNUE_BLOB_COUNT = sizeof(NNUE_BLOBS) / sizeof(NNUE_BLOBS[0]);
@@ -2,22 +2,15 @@
 #include <algorithm>
 
 // Get score for each pattern type
-int PatternDetector::getPatternScore(PatternType type) {
-    switch (type) {
-        case PatternType::FIVE:        return 100000;  // Win
-        case PatternType::OPEN_FOUR:   return 10000;   // Must block
-        case PatternType::FOUR:        return 5000;    // Strong threat
-        case PatternType::OPEN_THREE:  return 1000;    // Good threat
-        case PatternType::THREE:       return 500;     // Weak threat
-        case PatternType::OPEN_TWO:    return 100;     // Potential
-        case PatternType::TWO:         return 50;      // Weak potential
-        case PatternType::ONE:         return 10;      // Very weak
-        default:                       return 0;
-    }
+template <int N>
+int PatternDetector<N>::getPatternScore(PatternType type) {
+    int index = static_cast<int>(type);
+    return (index >= 0 && index < PATTERN_TYPE_COUNT) ? PATTERN_WEIGHTS[index] : 0;
 }
 
 // Analyze a single direction for patterns
-int PatternDetector::analyzeDirection(const Board& board, int x, int y, int dx, int dy, Cell player) {
+template <int N>
+int PatternDetector<N>::analyzeDirection(const Board<N>& board, int x, int y, int dx, int dy, Cell player) {
     int count = 1;  // Count the piece at (x, y)
     bool leftOpen = false;
     bool rightOpen = false;
@@ -27,7 +20,7 @@ int PatternDetector::analyzeDirection(const Board& board, int x, int y, int dx,
     int ny = y + dy;
     int spaces = 0;
     
-    while (nx >= 0 && nx < 20 && ny >= 0 && ny < 20 && spaces < 1) {
+    while (nx >= 0 && nx < N && ny >= 0 && ny < N && spaces < 1) {
         Cell cell = board.getCell(nx, ny);
         if (cell == player) {
             count++;
@@ -48,7 +41,7 @@ int PatternDetector::analyzeDirection(const Board& board, int x, int y, int dx,
     ny = y - dy;
     spaces = 0;
     
-    while (nx >= 0 && nx < 20 && ny >= 0 && ny < 20 && spaces < 1) {
+    while (nx >= 0 && nx < N && ny >= 0 && ny < N && spaces < 1) {
         Cell cell = board.getCell(nx, ny);
         if (cell == player) {
             count++;
@@ -97,7 +90,8 @@ int PatternDetector::analyzeDirection(const Board& board, int x, int y, int dx,
 }
 
 // Analyze all patterns for a position
-Pattern PatternDetector::analyzePosition(const Board& board, int x, int y, Cell player) {
+template <int N>
+Pattern PatternDetector<N>::analyzePosition(const Board<N>& board, int x, int y, Cell player) {
     Pattern result;
     result.count = 0;
     result.score = 0;
@@ -118,134 +112,75 @@ Pattern PatternDetector::analyzePosition(const Board& board, int x, int y, Cell
     return result;
 }
 
-// Check if position has open four
-bool PatternDetector::hasOpenFour(const Board& board, int x, int y, Cell player) {
-    const int directions[4][2] = {{1, 0}, {0, 1}, {1, 1}, {1, -1}};
-    
-    for (int i = 0; i < 4; i++) {
-        int count = board.countConsecutive(x, y, directions[i][0], directions[i][1], player);
-        if (count == 4) {
-            // Check if both ends are open
-            int x1 = x - directions[i][0];
-            int y1 = y - directions[i][1];
-            int x2 = x + directions[i][0] * 4;
-            int y2 = y + directions[i][1] * 4;
-            
-            bool open1 = (x1 >= 0 && x1 < 20 && y1 >= 0 && y1 < 20 && 
-                         board.getCell(x1, y1) == Cell::EMPTY);
-            bool open2 = (x2 >= 0 && x2 < 20 && y2 >= 0 && y2 < 20 && 
-                         board.getCell(x2, y2) == Cell::EMPTY);
-            
-            if (open1 && open2) {
-                return true;
-            }
-        }
+// Single-stone probes below are threat map reads (see Board::getThreats)
+
+template <int N>
+MoveThreat PatternDetector<N>::classifyMove(const Board<N>& board, int x, int y, Cell player) {
+    int fours = 0;
+    int openThrees = 0;
+    int threes = 0;
+    for (int d = 0; d < 4; d++) {
+        uint8_t line = board.getLineThreats(x, y, d, player);
+        if (line & THREAT_FIVE) return MoveThreat::FIVE;
+        if (line & THREAT_STRAIGHT_FOUR) return MoveThreat::STRAIGHT_FOUR;
+        fours += (line & THREAT_FOUR) ? 1 : 0;
+        openThrees += (line & THREAT_OPEN_THREE) ? 1 : 0;
+        threes += (line & THREAT_THREE) ? 1 : 0;
     }
-    return false;
+
+    if (fours >= 2) return MoveThreat::DOUBLE_FOUR;
+    if (fours && openThrees) return MoveThreat::FOUR_THREE;
+    if (openThrees >= 2) return MoveThreat::DOUBLE_THREE;
+    if (fours) return MoveThreat::FOUR;
+    if (openThrees) return MoveThreat::OPEN_THREE;
+    if (threes) return MoveThreat::THREE;
+    return MoveThreat::NONE;
 }
 
-// Check if position has open three
-bool PatternDetector::hasOpenThree(const Board& board, int x, int y, Cell player) {
-    const int directions[4][2] = {{1, 0}, {0, 1}, {1, 1}, {1, -1}};
-    
-    for (int i = 0; i < 4; i++) {
-        int count = board.countConsecutive(x, y, directions[i][0], directions[i][1], player);
-        if (count == 3) {
-            int x1 = x - directions[i][0];
-            int y1 = y - directions[i][1];
-            int x2 = x + directions[i][0] * 3;
-            int y2 = y + directions[i][1] * 3;
-            
-            bool open1 = (x1 >= 0 && x1 < 20 && y1 >= 0 && y1 < 20 && 
-                         board.getCell(x1, y1) == Cell::EMPTY);
-            bool open2 = (x2 >= 0 && x2 < 20 && y2 >= 0 && y2 < 20 && 
-                         board.getCell(x2, y2) == Cell::EMPTY);
-            
-            if (open1 && open2) {
-                return true;
-            }
-        }
-    }
-    return false;
+// Check if position has open (straight) four
+template <int N>
+bool PatternDetector<N>::hasOpenFour(const Board<N>& board, int x, int y, Cell player) {
+    return board.getThreats(x, y, player) & THREAT_STRAIGHT_FOUR;
 }
 
-// Check if position has four (not necessarily open)
-bool PatternDetector::hasFour(const Board& board, int x, int y, Cell player) {
-    const int directions[4][2] = {{1, 0}, {0, 1}, {1, 1}, {1, -1}};
-    
-    for (int i = 0; i < 4; i++) {
-        int count = board.countConsecutive(x, y, directions[i][0], directions[i][1], player);
-        if (count >= 4) {
-            return true;
-        }
-    }
-    return false;
+// Check if position has open three (contiguous or broken)
+template <int N>
+bool PatternDetector<N>::hasOpenThree(const Board<N>& board, int x, int y, Cell player) {
+    return board.getThreats(x, y, player) & THREAT_OPEN_THREE;
 }
 
-// Check if position has three
-bool PatternDetector::hasThree(const Board& board, int x, int y, Cell player) {
-    const int directions[4][2] = {{1, 0}, {0, 1}, {1, 1}, {1, -1}};
-    
-    for (int i = 0; i < 4; i++) {
-        int count = board.countConsecutive(x, y, directions[i][0], directions[i][1], player);
-        if (count >= 3) {
-            return true;
-        }
-    }
-    return false;
+// Check if position has four or better (not necessarily open)
+template <int N>
+bool PatternDetector<N>::hasFour(const Board<N>& board, int x, int y, Cell player) {
+    return board.getThreats(x, y, player) & THREAT_ANY_FOUR;
 }
 
-// Evaluate all patterns on the board for a player
-int PatternDetector::evaluatePatterns(const Board& board, Cell player) {
-    int totalScore = 0;
-    
-    for (int y = 0; y < 20; y++) {
-        for (int x = 0; x < 20; x++) {
-            if (board.getCell(x, y) == player) {
-                Pattern pattern = analyzePosition(board, x, y, player);
-                totalScore += pattern.score;
-            }
-        }
-    }
-    
-    return totalScore;
+// Check if position has three or better
+template <int N>
+bool PatternDetector<N>::hasThree(const Board<N>& board, int x, int y, Cell player) {
+    return board.getThreats(x, y, player) & THREAT_ANY;
 }
 
 // Check if a move creates a double threat
-bool PatternDetector::isDoubleThreat(const Board& board, int x, int y, Cell player) {
-    Board tempBoard = board;
-    tempBoard.placeStone(x, y, player);
-    
-    int threatCount = 0;
-    
-    // Check all directions for open threes or fours
-    const int directions[4][2] = {{1, 0}, {0, 1}, {1, 1}, {1, -1}};
-    
-    for (int i = 0; i < 4; i++) {
-        int count = tempBoard.countConsecutive(x, y, directions[i][0], directions[i][1], player);
-        if (count >= 3) {
-            threatCount++;
-        }
-    }
-    
-    return threatCount >= 2;
+template <int N>
+bool PatternDetector<N>::isDoubleThreat(const Board<N>& board, int x, int y, Cell player) {
+    MoveThreat threat = classifyMove(board, x, y, player);
+    return threat == MoveThreat::DOUBLE_FOUR || threat == MoveThreat::FOUR_THREE ||
+           threat == MoveThreat::DOUBLE_THREE;
 }
 
-// Find all threatening moves
-std::vector<Move> PatternDetector::findThreats(const Board& board, Cell player) {
+// Find all threatening moves (five, straight four or open three)
+template <int N>
+std::vector<Move> PatternDetector<N>::findThreats(const Board<N>& board, Cell player) {
     std::vector<Move> threats;
     
-    for (int y = 0; y < 20; y++) {
-        for (int x = 0; x < 20; x++) {
-            if (board.isValidMove(x, y)) {
-                Board tempBoard = board;
-                tempBoard.placeStone(x, y, player);
-                
-                if (tempBoard.checkWin(x, y, player) || 
-                    hasOpenFour(tempBoard, x, y, player) ||
-                    hasOpenThree(tempBoard, x, y, player)) {
-                    threats.emplace_back(x, y);
-                }
+    // A threat cell is at most 4 cells away from a stone of its line
+    BoardArea area = board.getStoneArea(4);
+    for (int y = area.minY; y <= area.maxY; y++) {
+        for (int x = area.minX; x <= area.maxX; x++) {
+            if (board.isValidMove(x, y) &&
+                (board.getThreats(x, y, player) & (THREAT_FIVE | THREAT_STRAIGHT_FOUR | THREAT_OPEN_THREE))) {
+                threats.emplace_back(x, y);
             }
         }
     }
@@ -254,7 +189,8 @@ std::vector<Move> PatternDetector::findThreats(const Board& board, Cell player)
 }
 
 // Check if a position is open (has empty neighbors)
-bool PatternDetector::isOpen(const Board& board, int x, int y) {
+template <int N>
+bool PatternDetector<N>::isOpen(const Board<N>& board, int x, int y) {
     const int offsets[8][2] = {
         {-1, -1}, {-1, 0}, {-1, 1},
         {0, -1},           {0, 1},
@@ -265,7 +201,7 @@ bool PatternDetector::isOpen(const Board& board, int x, int y) {
         int nx = x + offsets[i][0];
         int ny = y + offsets[i][1];
         
-        if (nx >= 0 && nx < 20 && ny >= 0 && ny < 20) {
+        if (nx >= 0 && nx < N && ny >= 0 && ny < N) {
             if (board.getCell(nx, ny) != Cell::EMPTY) {
                 return true;
             }
@@ -274,3 +210,7 @@ bool PatternDetector::isOpen(const Board& board, int x, int y) {
     
     return false;
 }
+
+// Supported sizes
+template class PatternDetector<15>;
+template class PatternDetector<20>;
@@ -0,0 +1,294 @@
+#include "pattern.hpp"
+#include <bit>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define PATTERN_KERNEL_X86 1
+#endif
+
+// Line-parallel version of analyzeDirection. Every lane is a row, column or
+// diagonal; for each color, each maximal run of k stones scores k times its
+// pattern, since every stone of the run sees the same run.
+//
+// Run counts per color and pattern type, indexed like PatternType:
+//   FIVE              stones in runs of 5+
+//   OPEN_FOUR .. ONE  runs of exact length k with both / one free end
+using LineKernel = void (*)(const uint32_t* black, const uint32_t* white,
+                            const uint32_t* valid, int lanes, int64_t runs[2][PATTERN_TYPE_COUNT]);
+
+// Scalar fallback, one lane at a time
+static inline void countColorScalar(uint32_t p, uint32_t e, int64_t* runs) {
+    uint32_t start = p & ~(p << 1);
+    uint32_t a2 = p & (p >> 1);
+    uint32_t a3 = a2 & (p >> 2);
+    uint32_t a4 = a3 & (p >> 3);
+    uint32_t a5 = a4 & (p >> 4);
+
+    uint32_t x1 = start & ~a2;
+    uint32_t x2 = start & a2 & ~a3;
+    uint32_t x3 = start & a3 & ~a4;
+    uint32_t x4 = start & a4 & ~a5;
+
+    uint32_t left = e << 1;
+    uint32_t five = a5 | (a5 << 1) | (a5 << 2) | (a5 << 3) | (a5 << 4);
+
+    runs[0] += std::popcount(five);
+    runs[1] += std::popcount(x4 & left & (e >> 4));
+    runs[2] += std::popcount(x4 & (left ^ (e >> 4)));
+    runs[3] += std::popcount(x3 & left & (e >> 3));
+    runs[4] += std::popcount(x3 & (left ^ (e >> 3)));
+    runs[5] += std::popcount(x2 & left & (e >> 2));
+    runs[6] += std::popcount(x2 & (left ^ (e >> 2)));
+    runs[7] += std::popcount(x1 & (left | (e >> 1)));
+}
+
+static void countRunsScalar(const uint32_t* black, const uint32_t* white,
+                            const uint32_t* valid, int lanes, int64_t runs[2][PATTERN_TYPE_COUNT]) {
+    for (int i = 0; i < lanes; i++) {
+        uint32_t e = valid[i] & ~(black[i] | white[i]);
+        countColorScalar(black[i], e, runs[0]);
+        countColorScalar(white[i], e, runs[1]);
+    }
+}
+
+#ifdef PATTERN_KERNEL_X86
+
+// Byte counters hold at most 8 per step, flush them before they overflow
+static const int FLUSH_INTERVAL = 16;
+
+// 8 lanes per step. Per-byte popcounts (nibble lookup) are accumulated
+// with byte adds and only widened with SAD on flush.
+__attribute__((target("avx2")))
+static inline __m256i popcountBytesAVX2(__m256i v) {
+    const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i nibble = _mm256_set1_epi8(0x0f);
+    __m256i lo = _mm256_shuffle_epi8(lookup, _mm256_and_si256(v, nibble));
+    __m256i hi = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble));
+    return _mm256_add_epi8(lo, hi);
+}
+
+__attribute__((target("avx2")))
+static inline void countColorAVX2(__m256i p, __m256i e, __m256i* acc) {
+    __m256i start = _mm256_andnot_si256(_mm256_slli_epi32(p, 1), p);
+    __m256i a2 = _mm256_and_si256(p, _mm256_srli_epi32(p, 1));
+    __m256i a3 = _mm256_and_si256(a2, _mm256_srli_epi32(p, 2));
+    __m256i a4 = _mm256_and_si256(a3, _mm256_srli_epi32(p, 3));
+    __m256i a5 = _mm256_and_si256(a4, _mm256_srli_epi32(p, 4));
+
+    __m256i x1 = _mm256_andnot_si256(a2, start);
+    __m256i x2 = _mm256_andnot_si256(a3, _mm256_and_si256(start, a2));
+    __m256i x3 = _mm256_andnot_si256(a4, _mm256_and_si256(start, a3));
+    __m256i x4 = _mm256_andnot_si256(a5, _mm256_and_si256(start, a4));
+
+    __m256i left = _mm256_slli_epi32(e, 1);
+    __m256i r1 = _mm256_srli_epi32(e, 1);
+    __m256i r2 = _mm256_srli_epi32(e, 2);
+    __m256i r3 = _mm256_srli_epi32(e, 3);
+    __m256i r4 = _mm256_srli_epi32(e, 4);
+
+    __m256i five = _mm256_or_si256(
+        _mm256_or_si256(a5, _mm256_slli_epi32(a5, 1)),
+        _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(a5, 2), _mm256_slli_epi32(a5, 3)),
+                        _mm256_slli_epi32(a5, 4)));
+
+    acc[0] = _mm256_add_epi8(acc[0], popcountBytesAVX2(five));
+    acc[1] = _mm256_add_epi8(acc[1], popcountBytesAVX2(_mm256_and_si256(x4, _mm256_and_si256(left, r4))));
+    acc[2] = _mm256_add_epi8(acc[2], popcountBytesAVX2(_mm256_and_si256(x4, _mm256_xor_si256(left, r4))));
+    acc[3] = _mm256_add_epi8(acc[3], popcountBytesAVX2(_mm256_and_si256(x3, _mm256_and_si256(left, r3))));
+    acc[4] = _mm256_add_epi8(acc[4], popcountBytesAVX2(_mm256_and_si256(x3, _mm256_xor_si256(left, r3))));
+    acc[5] = _mm256_add_epi8(acc[5], popcountBytesAVX2(_mm256_and_si256(x2, _mm256_and_si256(left, r2))));
+    acc[6] = _mm256_add_epi8(acc[6], popcountBytesAVX2(_mm256_and_si256(x2, _mm256_xor_si256(left, r2))));
+    acc[7] = _mm256_add_epi8(acc[7], popcountBytesAVX2(_mm256_and_si256(x1, _mm256_or_si256(left, r1))));
+}
+
+__attribute__((target("avx2")))
+static inline void flushAVX2(__m256i* acc, int64_t* runs) {
+    for (int t = 0; t < PATTERN_TYPE_COUNT; t++) {
+        alignas(32) int64_t parts[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(parts),
+                           _mm256_sad_epu8(acc[t], _mm256_setzero_si256()));
+        runs[t] += parts[0] + parts[1] + parts[2] + parts[3];
+        acc[t] = _mm256_setzero_si256();
+    }
+}
+
+__attribute__((target("avx2")))
+static void countRunsAVX2(const uint32_t* black, const uint32_t* white,
+                          const uint32_t* valid, int lanes, int64_t runs[2][PATTERN_TYPE_COUNT]) {
+    __m256i acc[2][PATTERN_TYPE_COUNT];
+    for (auto& color : acc) {
+        for (auto& a : color) {
+            a = _mm256_setzero_si256();
+        }
+    }
+
+    for (int i = 0, step = 0; i < lanes; i += 8) {
+        __m256i b = _mm256_load_si256(reinterpret_cast<const __m256i*>(black + i));
+        __m256i w = _mm256_load_si256(reinterpret_cast<const __m256i*>(white + i));
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(valid + i));
+        __m256i e = _mm256_andnot_si256(_mm256_or_si256(b, w), v);
+
+        countColorAVX2(b, e, acc[0]);
+        countColorAVX2(w, e, acc[1]);
+
+        if (++step == FLUSH_INTERVAL) {
+            flushAVX2(acc[0], runs[0]);
+            flushAVX2(acc[1], runs[1]);
+            step = 0;
+        }
+    }
+
+    flushAVX2(acc[0], runs[0]);
+    flushAVX2(acc[1], runs[1]);
+}
+
+// 4 lanes per step, same algorithm on 128-bit registers
+__attribute__((target("sse4.1")))
+static inline __m128i popcountBytesSSE4(__m128i v) {
+    const __m128i lookup = _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m128i nibble = _mm_set1_epi8(0x0f);
+    __m128i lo = _mm_shuffle_epi8(lookup, _mm_and_si128(v, nibble));
+    __m128i hi = _mm_shuffle_epi8(lookup, _mm_and_si128(_mm_srli_epi16(v, 4), nibble));
+    return _mm_add_epi8(lo, hi);
+}
+
+__attribute__((target("sse4.1")))
+static inline void countColorSSE4(__m128i p, __m128i e, __m128i* acc) {
+    __m128i start = _mm_andnot_si128(_mm_slli_epi32(p, 1), p);
+    __m128i a2 = _mm_and_si128(p, _mm_srli_epi32(p, 1));
+    __m128i a3 = _mm_and_si128(a2, _mm_srli_epi32(p, 2));
+    __m128i a4 = _mm_and_si128(a3, _mm_srli_epi32(p, 3));
+    __m128i a5 = _mm_and_si128(a4, _mm_srli_epi32(p, 4));
+
+    __m128i x1 = _mm_andnot_si128(a2, start);
+    __m128i x2 = _mm_andnot_si128(a3, _mm_and_si128(start, a2));
+    __m128i x3 = _mm_andnot_si128(a4, _mm_and_si128(start, a3));
+    __m128i x4 = _mm_andnot_si128(a5, _mm_and_si128(start, a4));
+
+    __m128i left = _mm_slli_epi32(e, 1);
+    __m128i r1 = _mm_srli_epi32(e, 1);
+    __m128i r2 = _mm_srli_epi32(e, 2);
+    __m128i r3 = _mm_srli_epi32(e, 3);
+    __m128i r4 = _mm_srli_epi32(e, 4);
+
+    __m128i five = _mm_or_si128(
+        _mm_or_si128(a5, _mm_slli_epi32(a5, 1)),
+        _mm_or_si128(_mm_or_si128(_mm_slli_epi32(a5, 2), _mm_slli_epi32(a5, 3)),
+                     _mm_slli_epi32(a5, 4)));
+
+    acc[0] = _mm_add_epi8(acc[0], popcountBytesSSE4(five));
+    acc[1] = _mm_add_epi8(acc[1], popcountBytesSSE4(_mm_and_si128(x4, _mm_and_si128(left, r4))));
+    acc[2] = _mm_add_epi8(acc[2], popcountBytesSSE4(_mm_and_si128(x4, _mm_xor_si128(left, r4))));
+    acc[3] = _mm_add_epi8(acc[3], popcountBytesSSE4(_mm_and_si128(x3, _mm_and_si128(left, r3))));
+    acc[4] = _mm_add_epi8(acc[4], popcountBytesSSE4(_mm_and_si128(x3, _mm_xor_si128(left, r3))));
+    acc[5] = _mm_add_epi8(acc[5], popcountBytesSSE4(_mm_and_si128(x2, _mm_and_si128(left, r2))));
+    acc[6] = _mm_add_epi8(acc[6], popcountBytesSSE4(_mm_and_si128(x2, _mm_xor_si128(left, r2))));
+    acc[7] = _mm_add_epi8(acc[7], popcountBytesSSE4(_mm_and_si128(x1, _mm_or_si128(left, r1))));
+}
+
+__attribute__((target("sse4.1")))
+static inline void flushSSE4(__m128i* acc, int64_t* runs) {
+    for (int t = 0; t < PATTERN_TYPE_COUNT; t++) {
+        alignas(16) int64_t parts[2];
+        _mm_store_si128(reinterpret_cast<__m128i*>(parts), _mm_sad_epu8(acc[t], _mm_setzero_si128()));
+        runs[t] += parts[0] + parts[1];
+        acc[t] = _mm_setzero_si128();
+    }
+}
+
+__attribute__((target("sse4.1")))
+static void countRunsSSE4(const uint32_t* black, const uint32_t* white,
+                          const uint32_t* valid, int lanes, int64_t runs[2][PATTERN_TYPE_COUNT]) {
+    __m128i acc[2][PATTERN_TYPE_COUNT];
+    for (auto& color : acc) {
+        for (auto& a : color) {
+            a = _mm_setzero_si128();
+        }
+    }
+
+    for (int i = 0, step = 0; i < lanes; i += 4) {
+        __m128i b = _mm_load_si128(reinterpret_cast<const __m128i*>(black + i));
+        __m128i w = _mm_load_si128(reinterpret_cast<const __m128i*>(white + i));
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(valid + i));
+        __m128i e = _mm_andnot_si128(_mm_or_si128(b, w), v);
+
+        countColorSSE4(b, e, acc[0]);
+        countColorSSE4(w, e, acc[1]);
+
+        if (++step == FLUSH_INTERVAL) {
+            flushSSE4(acc[0], runs[0]);
+            flushSSE4(acc[1], runs[1]);
+            step = 0;
+        }
+    }
+
+    flushSSE4(acc[0], runs[0]);
+    flushSSE4(acc[1], runs[1]);
+}
+
+#endif // PATTERN_KERNEL_X86
+
+// Pick the widest implementation the CPU supports (once)
+struct KernelChoice {
+    LineKernel kernel;
+    const char* name;
+};
+
+static KernelChoice selectKernel() {
+#ifdef PATTERN_KERNEL_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return {countRunsAVX2, "avx2"};
+    }
+    if (__builtin_cpu_supports("sse4.1")) {
+        return {countRunsSSE4, "sse4.1"};
+    }
+#endif
+    return {countRunsScalar, "scalar"};
+}
+
+static const KernelChoice activeKernel = selectKernel();
+
+template <int N>
+const char* PatternDetector<N>::getKernelName() {
+    return activeKernel.name;
+}
+
+// Per color, number of (stone, direction) pairs scoring each PatternType
+template <int N>
+void PatternDetector<N>::countLinePatterns(const Board<N>& board, int counts[2][PATTERN_TYPE_COUNT]) {
+    int64_t runs[2][PATTERN_TYPE_COUNT] = {};
+    activeKernel.kernel(board.getLineMasks(Cell::BLACK), board.getLineMasks(Cell::WHITE),
+                        Board<N>::Lines::validMasks.data(), Board<N>::Lines::LANES, runs);
+
+    // Runs of length k are seen once per stone
+    static const int runLength[PATTERN_TYPE_COUNT] = {1, 4, 4, 3, 3, 2, 2, 1};
+    for (int c = 0; c < 2; c++) {
+        for (int t = 0; t < PATTERN_TYPE_COUNT; t++) {
+            counts[c][t] = static_cast<int>(runs[c][t]) * runLength[t];
+        }
+    }
+}
+
+template <int N>
+void PatternDetector<N>::evaluateBoard(const Board<N>& board, int& blackScore, int& whiteScore) {
+    int counts[2][PATTERN_TYPE_COUNT];
+    countLinePatterns(board, counts);
+
+    blackScore = 0;
+    whiteScore = 0;
+    for (int t = 0; t < PATTERN_TYPE_COUNT; t++) {
+        int score = getPatternScore(static_cast<PatternType>(t));
+        blackScore += counts[0][t] * score;
+        whiteScore += counts[1][t] * score;
+    }
+}
+
+// Supported sizes (the rest of PatternDetector is instantiated in pattern.cpp)
+template const char* PatternDetector<15>::getKernelName();
+template const char* PatternDetector<20>::getKernelName();
+template void PatternDetector<15>::countLinePatterns(const Board<15>&, int[2][PATTERN_TYPE_COUNT]);
+template void PatternDetector<20>::countLinePatterns(const Board<20>&, int[2][PATTERN_TYPE_COUNT]);
+template void PatternDetector<15>::evaluateBoard(const Board<15>&, int&, int&);
+template void PatternDetector<20>::evaluateBoard(const Board<20>&, int&, int&);
@@ -1,24 +1,56 @@
 #include "protocol.hpp"
 #include "utils.hpp"
+#include "gamerecord.hpp"
+#include "experience.hpp"
+#include "latency.hpp"
+#include <chrono>
+#include <ctime>
 #include <sstream>
 
 // Global state to track our color
 static Cell myColor = Cell::BLACK;
-static Board* globalBoard = nullptr;
-static AI* globalAI = nullptr;
+static std::unique_ptr<Engine> globalEngine; // Created by START for the requested size
+static EngineOptions engineOptions;
 static bool gameStarted = false;
 
+// Optional game recording (--record FILE)
+static GameRecordWriter recorder;
+static GameRecord currentGame;
+static bool recordBroken = false; // Stones out of turn order: the game is not written
+
+// Optional experience file (--experience FILE)
+static ExperienceStore experience;
+
+// Move latency of the current game, from the line asking for a move (TURN,
+// BEGIN, BOARD's DONE) being read to our answer being flushed
+static LatencyStats latency;
+static std::chrono::steady_clock::time_point lineReceived;
+
+static void recordLatency() {
+    auto elapsed = std::chrono::steady_clock::now() - lineReceived;
+    latency.add(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count(),
+                engineOptions.limits.timeMs);
+}
+
 ProtocolHandler::ProtocolHandler() {
     // Constructor implementation
 }
 
-void ProtocolHandler::runCommunicationLoop(Board& board, AI& ai) {
-    globalBoard = &board;
-    globalAI = &ai;
+bool ProtocolHandler::setRecordFile(const std::string& path) {
+    return recorder.open(path);
+}
+
+bool ProtocolHandler::setExperienceFile(const std::string& path) {
+    return experience.open(path);
+}
+
+void ProtocolHandler::runCommunicationLoop(const EngineOptions& options) {
+    engineOptions = options;
 
     std::string line;
 
     while (std::getline(std::cin, line)) {
+        lineReceived = std::chrono::steady_clock::now();
         line = trimString(line);
 
         if (line.empty()) {
@@ -31,8 +63,8 @@ void ProtocolHandler::runCommunicationLoop(Board& board, AI& ai) {
             if (parts.size() >= 2) {
                 try {
                     int size = std::stoi(parts[1]);
-                    if (size != 20) {
-                        sendMessage("ERROR unsupported board size, only 20x20 supported");
+                    if (!isValidBoardSize(size)) {
+                        sendMessage("ERROR unsupported board size, only 15x15 and 20x20 supported");
                         continue;
                     }
                     handleStart(size);
@@ -92,11 +124,31 @@ void ProtocolHandler::runCommunicationLoop(Board& board, AI& ai) {
             sendMessage("UNKNOWN " + command);
         }
     }
+
+    // Input closed without END
+    reportLatency();
+    finishRecord();
+    recorder.close();
+    experience.flush();
 }
 
-void ProtocolHandler::handleStart(int) {
-    if (globalBoard) {
-        globalBoard->clear();
+void ProtocolHandler::handleStart(int boardSize) {
+    // The previous game's latency is only reported here or at END
+    reportLatency();
+    finishRecord();
+    currentGame.boardSize = boardSize;
+    latency.clear();
+
+    // Keep the engine (and its tables) when the size does not change
+    if (globalEngine && globalEngine->getBoardSize() == boardSize) {
+        globalEngine->newGame();
+    } else {
+        // Free the old tables first: two engines at once would break the memory budget
+        globalEngine.reset();
+        globalEngine = Engine::create(boardSize, engineOptions);
+    }
+    if (experience.isOpen()) {
+        globalEngine->loadExperience(experience);
     }
     sendMessage("OK");
 }
@@ -104,14 +156,14 @@ void ProtocolHandler::handleStart(int) {
 void ProtocolHandler::handleBegin() {
     // We play first (BLACK)
     // Play in the center
-    int centerX = 10;
-    int centerY = 10;
+    int centerX = globalEngine->getBoardSize() / 2;
+    int centerY = globalEngine->getBoardSize() / 2;
 
-    if (globalBoard) {
-        globalBoard->placeStone(centerX, centerY, myColor);
-    }
+    globalEngine->placeStone(centerX, centerY, myColor);
+    recordMove(centerX, centerY, myColor, nullptr, 0);
 
     sendMove(centerX, centerY);
+    recordLatency();
 }
 
 void ProtocolHandler::handleTurn(const std::string& command) {
@@ -133,7 +185,7 @@ void ProtocolHandler::handleTurn(const std::string& command) {
         int opponentY = std::stoi(coords[1]);
 
         // Validate coordinates
-        if (opponentX < 0 || opponentX >= 20 || opponentY < 0 || opponentY >= 20) {
+        if (!isValidCoordinate(opponentX, opponentY, globalEngine->getBoardSize())) {
             sendMessage("ERROR coordinates out of bounds");
             return;
         }
@@ -141,48 +193,33 @@ void ProtocolHandler::handleTurn(const std::string& command) {
         // Opponent color is opposite of ours
         Cell opponentColor = (myColor == Cell::BLACK) ? Cell::WHITE : Cell::BLACK;
 
-        if (globalBoard) {
-            // Check if the position is already occupied
-            if (!globalBoard->isValidMove(opponentX, opponentY)) {
-                sendMessage("ERROR square occupied");
-                return;
-            }
-
-            globalBoard->placeStone(opponentX, opponentY, opponentColor);
+        // Check if the position is already occupied
+        if (!globalEngine->isValidMove(opponentX, opponentY)) {
+            sendMessage("ERROR square occupied");
+            return;
+        }
 
-            // Now we need to play
-            Move bestMove = globalAI->findBestMove(*globalBoard, myColor);
+        globalEngine->placeStone(opponentX, opponentY, opponentColor);
+        recordMove(opponentX, opponentY, opponentColor, nullptr, 0);
 
-            // Check if move is valid
-            if (globalBoard->isValidMove(bestMove.first, bestMove.second)) {
-                globalBoard->placeStone(bestMove.first, bestMove.second, myColor);
-                sendMove(bestMove.first, bestMove.second);
-            } else {
-                // Fallback: find any valid move
-                auto availableMoves = globalBoard->getAvailableMoves();
-                if (!availableMoves.empty()) {
-                    Move fallback = availableMoves[0];
-                    globalBoard->placeStone(fallback.first, fallback.second, myColor);
-                    sendMove(fallback.first, fallback.second);
-                } else {
-                    sendMessage("ERROR no valid moves available");
-                }
-            }
-        }
+        // Now we need to play
+        playMove();
     } catch (const std::exception&) {
         sendMessage("ERROR invalid coordinate values");
     }
 }
 
 void ProtocolHandler::handleBoard(const std::string&) {
-    // Clear board first
-    if (globalBoard) {
-        globalBoard->clear();
-    }
+    // Clear board first (the record restarts from the stones sent here)
+    globalEngine->clearBoard();
+    currentGame.clear();
+    recordBroken = false;
+    std::vector<Move> stones[2]; // Black, white, in the order sent
 
     // Read board state line by line until "DONE"
     std::string line;
     while (std::getline(std::cin, line)) {
+        lineReceived = std::chrono::steady_clock::now(); // DONE asks for the move
         line = trimString(line);
 
         if (line == "DONE") {
@@ -198,7 +235,7 @@ void ProtocolHandler::handleBoard(const std::string&) {
                 int player = std::stoi(parts[2]);
 
                 // Validate coordinates
-                if (x < 0 || x >= 20 || y < 0 || y >= 20) {
+                if (!isValidCoordinate(x, y, globalEngine->getBoardSize())) {
                     sendMessage("ERROR board coordinates out of bounds");
                     continue;
                 }
@@ -211,14 +248,13 @@ void ProtocolHandler::handleBoard(const std::string&) {
 
                 Cell stone = (player == 1) ? Cell::BLACK : Cell::WHITE;
 
-                if (globalBoard) {
-                    // Check if position is already occupied
-                    if (!globalBoard->isValidMove(x, y)) {
-                        sendMessage("ERROR board position already occupied");
-                        continue;
-                    }
-                    globalBoard->placeStone(x, y, stone);
+                // Check if position is already occupied
+                if (!globalEngine->isValidMove(x, y)) {
+                    sendMessage("ERROR board position already occupied");
+                    continue;
                 }
+                globalEngine->placeStone(x, y, stone);
+                stones[player - 1].emplace_back(x, y);
             } catch (const std::exception&) {
                 sendMessage("ERROR invalid board data format");
                 continue;
@@ -229,49 +265,169 @@ void ProtocolHandler::handleBoard(const std::string&) {
         }
     }
 
+    // The record replays colors by move order: stones go in alternately,
+    // black first, which only works with as many black stones as white
+    // ones, or one more
+    size_t blacks = stones[0].size();
+    size_t whites = stones[1].size();
+    if (blacks == whites || blacks == whites + 1) {
+        for (size_t i = 0; i < blacks + whites; i++) {
+            const Move& stone = stones[i % 2][i / 2];
+            recordMove(stone.first, stone.second, (i % 2 == 0) ? Cell::BLACK : Cell::WHITE, nullptr, 0);
+        }
+    } else {
+        recordBroken = true;
+    }
+
     // Determine our color based on move count
-    if (globalBoard) {
-        int moveCount = globalBoard->getMoveCount();
-        // If odd number of moves, we are WHITE, otherwise BLACK
-        myColor = (moveCount % 2 == 0) ? Cell::BLACK : Cell::WHITE;
+    int moveCount = globalEngine->getMoveCount();
+    // If odd number of moves, we are WHITE, otherwise BLACK
+    myColor = (moveCount % 2 == 0) ? Cell::BLACK : Cell::WHITE;
 
-        // Now make our move
-        Move bestMove = globalAI->findBestMove(*globalBoard, myColor);
+    // Now make our move
+    playMove();
+}
 
-        if (globalBoard->isValidMove(bestMove.first, bestMove.second)) {
-            globalBoard->placeStone(bestMove.first, bestMove.second, myColor);
-            sendMove(bestMove.first, bestMove.second);
-        } else {
-            // Fallback
-            auto availableMoves = globalBoard->getAvailableMoves();
-            if (!availableMoves.empty()) {
-                Move fallback = availableMoves[0];
-                globalBoard->placeStone(fallback.first, fallback.second, myColor);
-                sendMove(fallback.first, fallback.second);
-            } else {
-                sendMessage("ERROR no valid moves available");
-            }
+// Search, play and send our move (any empty cell if the search fails)
+void ProtocolHandler::playMove() {
+    auto start = std::chrono::steady_clock::now();
+    Move bestMove = globalEngine->findBestMove(myColor);
+    int elapsedMs = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start).count());
+
+    if (!globalEngine->isValidMove(bestMove.first, bestMove.second)) {
+        bestMove = globalEngine->getFallbackMove();
+        if (bestMove.first < 0) {
+            sendMessage("ERROR no valid moves available");
+            return;
+        }
+    }
+
+    globalEngine->placeStone(bestMove.first, bestMove.second, myColor);
+    sendMove(bestMove.first, bestMove.second);
+    recordLatency();
+
+    if (recorder.isOpen()) {
+        SearchInfo info;
+        globalEngine->getSearchInfo(info);
+        if (currentGame.engineColor == Cell::EMPTY) {
+            currentGame.engineColor = myColor;
         }
+        recordMove(bestMove.first, bestMove.second, myColor, &info, elapsedMs);
     }
 }
 
-void ProtocolHandler::handleInfo(const std::string&) {
-    // INFO commands are optional, we can ignore them
-    // Or respond with appropriate values
+// Append a move to the current game record (after it is on the board).
+// Colors in the record follow move order (the first move is BLACK): a stone
+// out of turn means the game cannot be replayed, and it is dropped.
+void ProtocolHandler::recordMove(int x, int y, Cell stone, const SearchInfo* info, int timeMs) {
+    if (!recorder.isOpen() || recordBroken) {
+        return;
+    }
+
+    Cell recordColor = (currentGame.moves.size() % 2 == 0) ? Cell::BLACK : Cell::WHITE;
+    if (stone != recordColor) {
+        recordBroken = true;
+        return;
+    }
+    if (currentGame.moves.empty()) {
+        currentGame.startTime = static_cast<uint32_t>(std::time(nullptr));
+    }
+
+    RecordedMove entry{Move(x, y), 0, 0, timeMs};
+    if (info) {
+        entry.depth = info->depth;
+        entry.score = info->score;
+    }
+    currentGame.moves.push_back(entry);
+
+    if (globalEngine->checkWin(x, y, stone)) {
+        currentGame.result = (recordColor == Cell::BLACK) ? GameResult::BLACK_WIN : GameResult::WHITE_WIN;
+    }
+}
+
+// Write the current game (if any) and start an empty record. Also where the
+// game's deep search results go to the experience store (kept in memory,
+// written at END).
+void ProtocolHandler::finishRecord() {
+    if (experience.isOpen() && globalEngine) {
+        globalEngine->saveExperience(experience);
+    }
+
+    if (recorder.isOpen() && !recordBroken && !currentGame.moves.empty()) {
+        if (currentGame.result == GameResult::UNKNOWN &&
+            static_cast<int>(currentGame.moves.size()) == currentGame.boardSize * currentGame.boardSize) {
+            currentGame.result = GameResult::DRAW;
+        }
+        recorder.append(currentGame);
+    }
+    currentGame.clear();
+    recordBroken = false;
+}
+
+void ProtocolHandler::handleInfo(const std::string& command) {
+    // Search limits (0 = no limit); other INFO keys are ignored
+    auto parts = splitString(command, ' ');
+    const std::string& key = parts[1];
+    if (key != "max_depth" && key != "max_nodes" && key != "max_time_ms") {
+        return;
+    }
+
+    long long value = 0;
+    try {
+        value = std::stoll(parts[2]);
+    } catch (const std::exception&) {
+        sendMessage("ERROR invalid info value");
+        return;
+    }
+    if (value < 0 || (key != "max_nodes" && value > 1000000000)) {
+        sendMessage("ERROR invalid info value");
+        return;
+    }
+
+    if (key == "max_depth") {
+        engineOptions.limits.depth = static_cast<int>(value);
+    } else if (key == "max_nodes") {
+        engineOptions.limits.nodes = value;
+    } else {
+        engineOptions.limits.timeMs = static_cast<int>(value);
+    }
+
+    if (globalEngine) {
+        globalEngine->setLimits(engineOptions.limits);
+    }
 }
 
 void ProtocolHandler::handleAbout() {
     sendMessage("name=\"GomokuAI\", version=\"1.0\", author=\"YourTeam\"");
 }
 
+// Latency summary of the game, as MESSAGE lines
+void ProtocolHandler::reportLatency() {
+    if (latency.getMoveCount() > 0) {
+        sendMessage("MESSAGE latency " + latency.getSummary());
+        sendMessage("MESSAGE latency histogram " + latency.getHistogram());
+    }
+}
+
 void ProtocolHandler::handleEnd() {
     // Clean exit
+    reportLatency();
+    finishRecord();
+    recorder.close();
+    experience.flush();
     std::exit(0);
 }
 
 void ProtocolHandler::handleRestart() {
-    if (globalBoard) {
-        globalBoard->clear();
+    reportLatency();
+    finishRecord();
+    latency.clear();
+    if (globalEngine) {
+        globalEngine->newGame();
+        if (experience.isOpen()) {
+            globalEngine->loadExperience(experience);
+        }
     }
     gameStarted = false;
     myColor = Cell::BLACK;
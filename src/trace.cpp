@@ -0,0 +1,136 @@
+#include "trace.hpp"
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+
+std::atomic<bool> Trace::enabled(false);
+
+namespace {
+
+const char* EVENT_NAMES[] = {
+    "search_start", "iteration", "search_end", "node", "tt_cutoff", "probcut", "cutoff"
+};
+
+static_assert(sizeof(EVENT_NAMES) / sizeof(EVENT_NAMES[0]) == static_cast<size_t>(TraceEvent::COUNT),
+              "one name per trace event");
+
+// Rings are registered once per thread and live until exit
+std::mutex registryMutex;
+std::array<Trace::Ring*, Trace::MAX_THREADS> rings{};
+std::atomic<int> ringCount(0);
+
+std::FILE* output = nullptr;
+std::thread drainThread;
+std::atomic<bool> draining(false);
+
+// Copy out everything the producers have published; returns the record count
+size_t drainRings() {
+    size_t written = 0;
+    int count = ringCount.load(std::memory_order_acquire);
+
+    for (int i = 0; i < count; i++) {
+        Trace::Ring* ring = rings[i];
+        uint32_t tail = ring->tail.load(std::memory_order_relaxed);
+        uint32_t head = ring->head.load(std::memory_order_acquire);
+
+        for (; tail != head; tail++) {
+            const TraceRecord& record = ring->records[tail & (Trace::RING_SIZE - 1)];
+            std::fprintf(output, "%llu %u %s %d %d %d\n", static_cast<unsigned long long>(record.time),
+                         record.thread, Trace::getEventName(static_cast<TraceEvent>(record.event)),
+                         record.args[0], record.args[1], record.args[2]);
+            written++;
+        }
+        ring->tail.store(tail, std::memory_order_release);
+    }
+    return written;
+}
+
+#ifdef GOMOKU_TRACE
+void drainLoop() {
+    while (draining.load(std::memory_order_relaxed)) {
+        if (drainRings() == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
+#endif
+
+} // namespace
+
+const char* Trace::getEventName(TraceEvent event) {
+    int index = static_cast<int>(event);
+    return (index >= 0 && index < static_cast<int>(TraceEvent::COUNT)) ? EVENT_NAMES[index] : "unknown";
+}
+
+uint64_t Trace::now() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+Trace::Ring* Trace::getRing() {
+    thread_local Ring* ring = nullptr;
+    thread_local bool registered = false;
+
+    if (!registered) {
+        registered = true;
+        std::lock_guard<std::mutex> lock(registryMutex);
+        int count = ringCount.load(std::memory_order_relaxed);
+        if (count < MAX_THREADS) {
+            ring = new Ring();
+            ring->thread = static_cast<uint16_t>(count);
+            rings[count] = ring;
+            ringCount.store(count + 1, std::memory_order_release);
+        }
+    }
+    return ring;
+}
+
+bool Trace::start(const std::string& path) {
+#ifdef GOMOKU_TRACE
+    if (draining.load()) {
+        return false;
+    }
+    output = (path == "-") ? stderr : std::fopen(path.c_str(), "w");
+    if (!output) {
+        return false;
+    }
+
+    static bool exitHandler = false;
+    if (!exitHandler) {
+        exitHandler = true;
+        std::atexit(stop);
+    }
+    draining.store(true);
+    drainThread = std::thread(drainLoop);
+    enabled.store(true);
+    return true;
+#else
+    (void)path;
+    return false;
+#endif
+}
+
+void Trace::stop() {
+    if (!draining.exchange(false)) {
+        return;
+    }
+    enabled.store(false);
+    drainThread.join();
+    drainRings();
+
+    uint64_t dropped = 0;
+    int count = ringCount.load(std::memory_order_acquire);
+    for (int i = 0; i < count; i++) {
+        dropped += rings[i]->dropped.load(std::memory_order_relaxed);
+    }
+    if (dropped > 0) {
+        std::fprintf(output, "# %llu records dropped (ring full)\n", static_cast<unsigned long long>(dropped));
+    }
+    if (output != stderr) {
+        std::fclose(output);
+    }
+    output = nullptr;
+}
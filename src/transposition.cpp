@@ -0,0 +1,81 @@
+#include "transposition.hpp"
+#include <algorithm>
+
+TranspositionTable::TranspositionTable() : mask(0), age(0) {
+    resize(DEFAULT_SIZE_MB);
+}
+
+// Round down to a power of two number of entries
+void TranspositionTable::resize(int megabytes) {
+    size_t count = 1;
+    size_t bytes = static_cast<size_t>(megabytes) * 1024 * 1024;
+    while (count * 2 * sizeof(TTEntry) <= bytes) {
+        count *= 2;
+    }
+
+    entries.assign(count, TTEntry{0, 0, -1, 0, 0});
+    mask = count - 1;
+    age = 0;
+}
+
+void TranspositionTable::clear() {
+    std::fill(entries.begin(), entries.end(), TTEntry{0, 0, -1, 0, 0});
+    age = 0;
+}
+
+// Called once per move: older entries become replaceable
+void TranspositionTable::newSearch() {
+    age = (age + 1) % PRELOAD_AGE;
+}
+
+bool TranspositionTable::probe(uint64_t key, TTEntry& entry) const {
+    const TTEntry& slot = entries[key & mask];
+    if (slot.key != key || getBound(slot) == Bound::NONE) {
+        return false;
+    }
+    entry = slot;
+    return true;
+}
+
+// Replace when the slot is empty, from an older search, the same position,
+// or not deeper than the new result
+void TranspositionTable::store(uint64_t key, int depth, int score, Bound bound, Move move) {
+    TTEntry& slot = entries[key & mask];
+    uint8_t slotAge = slot.boundAge >> 2;
+
+    bool replace = getBound(slot) == Bound::NONE || slotAge != age ||
+                   slot.key == key || depth >= slot.depth;
+    if (!replace) {
+        return;
+    }
+
+    // Keep the old move if the new result has none
+    int16_t packed = (move.first >= 0) ? static_cast<int16_t>((move.second << 5) | move.first)
+                                       : (slot.key == key ? slot.move : -1);
+
+    slot.key = key;
+    slot.score = score;
+    slot.move = packed;
+    slot.depth = static_cast<int8_t>(depth);
+    slot.boundAge = static_cast<uint8_t>((age << 2) | static_cast<uint8_t>(bound));
+}
+
+// Only into empty or shallower preloaded slots: a game never starts with
+// results of its own in the table, so this is just about colliding entries
+void TranspositionTable::preload(const TTEntry& entry) {
+    TTEntry& slot = entries[entry.key & mask];
+    if (getBound(slot) != Bound::NONE && entry.depth <= slot.depth) {
+        return;
+    }
+    slot = entry;
+    slot.boundAge = static_cast<uint8_t>((PRELOAD_AGE << 2) | (entry.boundAge & 3));
+}
+
+// Entries written by a search (not preloaded) at least minDepth deep
+void TranspositionTable::collectSearched(int minDepth, std::vector<TTEntry>& out) const {
+    for (const TTEntry& slot : entries) {
+        if (getBound(slot) != Bound::NONE && (slot.boundAge >> 2) != PRELOAD_AGE && slot.depth >= minDepth) {
+            out.push_back(slot);
+        }
+    }
+}
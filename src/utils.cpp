@@ -1,4 +1,5 @@
 #include "utils.hpp"
+#include "board.hpp"
 #include <iostream>
 #include <algorithm>
 #include <chrono>
@@ -59,10 +60,15 @@ bool patternMatch(const std::string& text, const std::string& pattern) {
 }
 
 // Validation helpers
-bool isValidCoordinate(int x, int y) {
-    return x >= 0 && x < 20 && y >= 0 && y < 20;
+bool isValidCoordinate(int x, int y, int boardSize) {
+    return x >= 0 && x < boardSize && y >= 0 && y < boardSize;
 }
 
 bool isValidBoardSize(int size) {
-    return size == 20;
+    for (int supported : SUPPORTED_BOARD_SIZES) {
+        if (size == supported) {
+            return true;
+        }
+    }
+    return false;
 }
@@ -0,0 +1,525 @@
+// Fixed-budget search benchmark. Every position is searched from a fresh
+// game with a fixed depth (alpha-beta) or playout count (MCTS) and no time
+// limit, so node counts are reproducible: a speed-only change must print the
+// same moves and nodes, and NPS can be compared between builds.
+// --stats turns alpha-beta pruning off and prints the statistics behind its
+// width constants (AI<N>::LMP_MOVES, PROBCUT_MARGIN).
+// --positions FILE searches the positions of FILE instead, one per line in
+// the BENCH_POSITIONS format, for larger --stats runs.
+// --counters adds hardware counters (perfcounters.hpp) per search node and
+// per call of the hot kernels, timed in isolation on the same positions.
+// Alpha-beta runs also print the evaluation cache hit rate (--eval-cache MB,
+// 0 turns it off).
+// --verify checks the threat map and evaluateBoard against brute-force line
+// scans on random positions and the scores of forced wins / losses, and exits
+// with 1 on the first mismatch.
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "ai.hpp"
+#include "board.hpp"
+#include "perfcounters.hpp"
+
+// Middle-game positions on 20x20, moves alternate starting with BLACK
+static const char* BENCH_POSITIONS[] = {
+    "10,10 11,11 11,9 9,11 12,8 10,11 8,11 9,10 12,11 9,12",
+    "10,10 10,11 9,11 9,10 8,12 7,13 8,10 8,9 11,12 11,9",
+    "9,9 11,10 10,12 10,10 9,11 12,10 9,10 9,12 8,10 7,9 7,11 10,8 10,11 8,11 8,9",
+    "5,5 6,6 7,3 7,6 6,4 4,6 8,6 6,7 7,5 5,3 6,5 8,5 10,8 9,7 8,2 9,1",
+    "10,10 12,12 8,9 12,11 12,10 12,13 11,10 9,10 11,9 13,10 11,8 11,7 9,9 10,9 10,8 9,7 8,8 12,14 12,15",
+    "15,4 14,5 13,2 13,5 14,3 12,1 12,5 15,5 13,4 11,6 16,5 17,6",
+};
+
+static const int DEFAULT_MCTS_PLAYOUTS = 20000;
+static const int KERNEL_REPEATS = 2000; // Calls per position for the kernel timings
+static const int VERIFY_POSITIONS = 2000; // Random positions per board size for --verify
+
+// Positions with a forced result for --verify: white has two open threes,
+// black only corner stones. Searched to depth 8, every iteration from depth 4
+// on must see the win or the loss.
+struct VerifySearch {
+    const char* moves;
+    bool won; // For the side to move
+};
+
+static const VerifySearch VERIFY_SEARCHES[] = {
+    {"0,0 8,8 19,0 9,8 0,19 10,8 19,19 12,12 1,0 12,13 18,0 12,14", false},
+    {"0,0 8,8 19,0 9,8 0,19 10,8 19,19 12,12 1,0 12,13 18,0 12,14 1,19", true},
+};
+static const int VERIFY_SEARCH_DEPTH = 8;
+static const int VERIFY_RESULT_DEPTH = 4;
+
+// Play a position string on an empty board, returns the side to move
+static Cell setupPosition(Board<20>& board, const std::string& moves) {
+    std::istringstream stream(moves);
+    std::string token;
+    Cell toMove = Cell::BLACK;
+
+    board.clear();
+    while (stream >> token) {
+        int x = std::stoi(token.substr(0, token.find(',')));
+        int y = std::stoi(token.substr(token.find(',') + 1));
+        board.placeStone(x, y, toMove);
+        toMove = (toMove == Cell::BLACK) ? Cell::WHITE : Cell::BLACK;
+    }
+    return toMove;
+}
+
+// Counter values divided by a number of nodes / calls, IPC when both are known
+static void printCounters(const char* label, const PerfCounters::Sample& sample, double divisor) {
+    std::printf("%s", label);
+    for (int event = 0; event < PerfCounters::EVENT_COUNT; event++) {
+        if (sample.valid[event]) {
+            std::printf(" %s %.1f", PerfCounters::getName(event), sample.values[event] / divisor);
+        } else {
+            std::printf(" %s n/a", PerfCounters::getName(event));
+        }
+    }
+    if (sample.valid[PerfCounters::CYCLES] && sample.valid[PerfCounters::INSTRUCTIONS] &&
+        sample.values[PerfCounters::CYCLES] > 0) {
+        std::printf(" IPC %.2f", sample.values[PerfCounters::INSTRUCTIONS] / sample.values[PerfCounters::CYCLES]);
+    }
+    std::printf("\n");
+}
+
+static void addSample(PerfCounters::Sample& total, const PerfCounters::Sample& sample) {
+    for (int event = 0; event < PerfCounters::EVENT_COUNT; event++) {
+        total.values[event] += sample.values[event];
+        total.valid[event] = sample.valid[event];
+    }
+}
+
+// One kernel called KERNEL_REPEATS times on every bench position. The
+// position's stones are listed before the clock starts, for kernels called
+// per stone.
+template <typename Kernel>
+static void benchKernel(const char* name, PerfCounters& counters, Kernel kernel) {
+    Board<20> board;
+    PerfCounters::Sample total;
+    double seconds = 0.0;
+    int64_t calls = 0;
+
+    for (const char* position : BENCH_POSITIONS) {
+        Cell toMove = setupPosition(board, position);
+        std::vector<Move> stones;
+        for (int y = 0; y < 20; y++) {
+            for (int x = 0; x < 20; x++) {
+                if (board.getCell(x, y) != Cell::EMPTY) {
+                    stones.emplace_back(x, y);
+                }
+            }
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        counters.start();
+        calls += kernel(board, toMove, stones);
+        addSample(total, counters.stop());
+        seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    std::printf("kernel %s: %lld calls, %.1f ns/call\n", name, static_cast<long long>(calls),
+                calls > 0 ? seconds * 1e9 / calls : 0.0);
+    if (counters.isAvailable()) {
+        printCounters("  per call:", total, static_cast<double>(calls));
+    }
+}
+
+static void benchKernels(AI<20>& ai, PerfCounters& counters) {
+    static volatile int sink = 0;
+
+    benchKernel("evaluateBoard", counters, [](const Board<20>& board, Cell, const std::vector<Move>&) {
+        for (int i = 0; i < KERNEL_REPEATS; i++) {
+            int black = 0;
+            int white = 0;
+            PatternDetector<20>::evaluateBoard(board, black, white);
+            sink = sink + black - white;
+        }
+        return KERNEL_REPEATS;
+    });
+
+    benchKernel("getOrderedMovesAdvanced", counters, [&ai](const Board<20>& board, Cell toMove, const std::vector<Move>&) {
+        MoveList moves;
+        for (int i = 0; i < KERNEL_REPEATS; i++) {
+            ai.getOrderedMovesAdvanced(board, toMove, moves);
+            sink = sink + moves.size();
+        }
+        return KERNEL_REPEATS;
+    });
+
+    // Only the calls are timed, on the stones listed beforehand
+    benchKernel("checkWin", counters, [](const Board<20>& board, Cell, const std::vector<Move>& stones) {
+        for (int i = 0; i < KERNEL_REPEATS; i++) {
+            for (const Move& stone : stones) {
+                sink = sink + board.checkWin(stone.first, stone.second, board.getCell(stone.first, stone.second));
+            }
+        }
+        return KERNEL_REPEATS * static_cast<int>(stones.size());
+    });
+}
+
+// Plain copy of a board for the brute-force scans, cheap to change and restore
+template <int N>
+using VerifyGrid = std::array<Cell, N * N>;
+
+// Cell test of the brute-force scans: off the board is neither own nor empty
+template <int N>
+static bool isCell(const VerifyGrid<N>& grid, int x, int y, Cell cell) {
+    return x >= 0 && x < N && y >= 0 && y < N && grid[y * N + x] == cell;
+}
+
+// Stones in a row through (x, y) along (dx, dy), (x, y) counted as own
+template <int N>
+static int runThrough(const VerifyGrid<N>& grid, int x, int y, int dx, int dy, Cell stone) {
+    int count = 1;
+    for (int side = -1; side <= 1; side += 2) {
+        int nx = x + side * dx;
+        int ny = y + side * dy;
+        while (isCell<N>(grid, nx, ny, stone)) {
+            count++;
+            nx += side * dx;
+            ny += side * dy;
+        }
+    }
+    return count;
+}
+
+// Empty cells of the line that would give five through (x, y)
+template <int N>
+static int countCompletions(VerifyGrid<N>& grid, int x, int y, int dx, int dy, Cell stone) {
+    int completions = 0;
+    for (int step = -4; step <= 4; step++) {
+        int cx = x + step * dx;
+        int cy = y + step * dy;
+        if (step == 0 || !isCell<N>(grid, cx, cy, Cell::EMPTY)) {
+            continue;
+        }
+        grid[cy * N + cx] = stone;
+        completions += runThrough<N>(grid, x, y, dx, dy, stone) >= 5;
+        grid[cy * N + cx] = Cell::EMPTY;
+    }
+    return completions;
+}
+
+// Threat class of (x, y) along one direction, straight from the definitions
+// of ThreatFlag
+template <int N>
+static uint8_t bruteForceThreat(VerifyGrid<N>& grid, int x, int y, int dx, int dy, Cell stone) {
+    if (runThrough<N>(grid, x, y, dx, dy, stone) >= 5) {
+        return THREAT_FIVE;
+    }
+    int completions = countCompletions<N>(grid, x, y, dx, dy, stone);
+    if (completions >= 2) {
+        return THREAT_STRAIGHT_FOUR;
+    }
+    if (completions == 1) {
+        return THREAT_FOUR;
+    }
+
+    uint8_t best = 0;
+    for (int step = -4; step <= 4; step++) {
+        int cx = x + step * dx;
+        int cy = y + step * dy;
+        if (step == 0 || !isCell<N>(grid, cx, cy, Cell::EMPTY)) {
+            continue;
+        }
+        grid[cy * N + cx] = stone;
+        int next = countCompletions<N>(grid, x, y, dx, dy, stone);
+        grid[cy * N + cx] = Cell::EMPTY;
+        if (next >= 2) {
+            return THREAT_OPEN_THREE;
+        }
+        if (next == 1) {
+            best = THREAT_THREE;
+        }
+    }
+    return best;
+}
+
+// Threat map and evaluateBoard of one position against the brute-force scans.
+// The evaluation reference is the per-stone analyzeDirection sum.
+template <int N>
+static bool verifyPosition(Board<N>& board, int position) {
+    VerifyGrid<N> grid;
+    for (int y = 0; y < N; y++) {
+        for (int x = 0; x < N; x++) {
+            grid[y * N + x] = board.getCell(x, y);
+        }
+    }
+
+    int reference[2] = {0, 0};
+    for (int y = 0; y < N; y++) {
+        for (int x = 0; x < N; x++) {
+            Cell cell = board.getCell(x, y);
+            for (int direction = 0; direction < 4; direction++) {
+                int dx = LINE_DIRECTIONS[direction][0];
+                int dy = LINE_DIRECTIONS[direction][1];
+                if (cell != Cell::EMPTY) {
+                    reference[cell == Cell::BLACK ? 0 : 1] +=
+                        PatternDetector<N>::analyzeDirection(board, x, y, dx, dy, cell);
+                }
+                for (Cell stone : {Cell::BLACK, Cell::WHITE}) {
+                    uint8_t expected = bruteForceThreat<N>(grid, x, y, dx, dy, stone);
+                    uint8_t actual = board.getLineThreats(x, y, direction, stone);
+                    if (expected != actual) {
+                        std::printf("verify %dx%d position %d: threat of %s at %d,%d direction %d is %d, expected %d\n",
+                                    N, N, position, stone == Cell::BLACK ? "black" : "white", x, y, direction,
+                                    actual, expected);
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+
+    int scores[2] = {0, 0};
+    PatternDetector<N>::evaluateBoard(board, scores[0], scores[1]);
+    if (scores[0] != reference[0] || scores[1] != reference[1]) {
+        std::printf("verify %dx%d position %d: evaluateBoard %d/%d, expected %d/%d\n", N, N, position,
+                    scores[0], scores[1], reference[0], reference[1]);
+        return false;
+    }
+    return true;
+}
+
+// Random positions: stones spread around a random center, then some taken
+// back so the incremental updates of removeStone are covered too
+template <int N>
+static bool verifyBoardSize(std::mt19937& random) {
+    Board<N> board;
+    for (int position = 0; position < VERIFY_POSITIONS; position++) {
+        board.clear();
+        std::normal_distribution<double> spread(0.0, 1.0 + position % 5);
+        int centerX = static_cast<int>(random() % N);
+        int centerY = static_cast<int>(random() % N);
+        int stones = static_cast<int>(random() % (N * 3));
+        std::vector<Move> placed;
+
+        for (int i = 0; i < stones; i++) {
+            int x = centerX + static_cast<int>(std::lround(spread(random)));
+            int y = centerY + static_cast<int>(std::lround(spread(random)));
+            Cell stone = (random() % 2) ? Cell::BLACK : Cell::WHITE;
+            if (board.placeStone(x, y, stone)) {
+                placed.emplace_back(x, y);
+            }
+        }
+        for (size_t i = 0; i < placed.size(); i += 1 + random() % 4) {
+            board.removeStone(placed[i].first, placed[i].second);
+        }
+        if (!verifyPosition(board, position)) {
+            return false;
+        }
+    }
+    std::printf("verify %dx%d: %d positions ok\n", N, N, VERIFY_POSITIONS);
+    return true;
+}
+
+// Forced results scored as wins / losses at every depth that reaches them
+static bool verifySearches() {
+    Board<20> board;
+    static AI<20> ai;
+    SearchLimits limits;
+    limits.depth = VERIFY_SEARCH_DEPTH;
+    limits.timeMs = 0;
+    ai.setLimits(limits);
+
+    int index = 0;
+    for (const VerifySearch& position : VERIFY_SEARCHES) {
+        Cell toMove = setupPosition(board, position.moves);
+        ai.newGame();
+        ai.findBestMove(board, toMove);
+        index++;
+        for (const IterationResult& iteration : ai.getIterations()) {
+            bool scored = position.won ? iteration.score >= AI<20>::WIN_SCORE
+                                       : iteration.score <= -AI<20>::WIN_SCORE;
+            if (iteration.depth >= VERIFY_RESULT_DEPTH && !scored) {
+                std::printf("verify search %d: depth %d move %d,%d score %d, expected a %s\n", index,
+                            iteration.depth, iteration.move.first, iteration.move.second, iteration.score,
+                            position.won ? "win" : "loss");
+                return false;
+            }
+        }
+    }
+    std::printf("verify search: %d positions ok\n", index);
+    return true;
+}
+
+// Cutoff move position per depth, and the reduced-search error of ProbCut
+static void printPruningStats(const PruningStats& stats) {
+    std::printf("late-move pruning: quiet moves searched at the cutoff\n");
+    for (int depth = 1; depth <= SearchLimits::MAX_DEPTH; depth++) {
+        int64_t total = 0;
+        for (int64_t count : stats.cutoffs[depth]) {
+            total += count;
+        }
+        if (total == 0) {
+            continue;
+        }
+
+        // Smallest limits keeping 95% / 99% of the cutoffs
+        int p95 = -1;
+        int p99 = -1;
+        int64_t seen = 0;
+        for (int index = 0; index < PruningStats::MAX_INDEX; index++) {
+            seen += stats.cutoffs[depth][index];
+            if (p95 < 0 && seen * 100 >= total * 95) p95 = index;
+            if (p99 < 0 && seen * 100 >= total * 99) p99 = index;
+        }
+        std::printf("  depth %d: cutoffs %lld, p95 %d, p99 %d\n", depth,
+                    static_cast<long long>(total), p95, p99);
+    }
+
+    std::printf("probcut: exact score - reduced score\n");
+    for (int depth = 1; depth <= SearchLimits::MAX_DEPTH; depth++) {
+        int64_t samples = stats.probCutSamples[depth];
+        if (samples == 0) {
+            continue;
+        }
+        double mean = stats.probCutSum[depth] / samples;
+        double deviation = std::sqrt(std::max(0.0, stats.probCutSquares[depth] / samples - mean * mean));
+        std::printf("  depth %d: samples %lld, mean %.0f, sd %.0f, margin (2 sd) %.0f\n", depth,
+                    static_cast<long long>(samples), mean, deviation, 2.0 * deviation - mean);
+    }
+}
+
+int main(int argc, char** argv) {
+    SearchLimits limits;
+    limits.timeMs = 0;
+    SearchMode mode = SearchMode::ALPHA_BETA;
+    Evaluation evaluation = Evaluation::PATTERNS;
+    int threads = 1;
+    int evalCacheMb = EvalCache::DEFAULT_SIZE_MB;
+    bool nodesGiven = false;
+    bool stats = false;
+    bool useCounters = false;
+    bool verify = false;
+    std::vector<std::string> positions(std::begin(BENCH_POSITIONS), std::end(BENCH_POSITIONS));
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        try {
+            if (arg == "--mcts") {
+                mode = SearchMode::MCTS;
+            } else if (arg == "--counters") {
+                useCounters = true;
+            } else if (arg == "--positions" && i + 1 < argc) {
+                std::ifstream file(argv[++i]);
+                if (!file) {
+                    std::cerr << "Cannot read " << argv[i] << std::endl;
+                    return 84;
+                }
+                positions.clear();
+                for (std::string line; std::getline(file, line);) {
+                    if (!line.empty()) {
+                        positions.push_back(line);
+                    }
+                }
+            } else if (arg == "--verify") {
+                verify = true;
+            } else if (arg == "--stats") {
+                stats = true;
+            } else if (arg == "--nnue") {
+                evaluation = Evaluation::NNUE;
+            } else if (arg == "--depth" && i + 1 < argc) {
+                limits.depth = std::stoi(argv[++i]);
+            } else if (arg == "--nodes" && i + 1 < argc) {
+                limits.nodes = std::stoll(argv[++i]);
+                nodesGiven = true;
+            } else if (arg == "--threads" && i + 1 < argc) {
+                threads = std::stoi(argv[++i]);
+            } else if (arg == "--eval-cache" && i + 1 < argc) {
+                evalCacheMb = std::stoi(argv[++i]);
+            } else {
+                throw std::invalid_argument(arg);
+            }
+        } catch (const std::exception&) {
+            std::cerr << "Usage: " << argv[0] << " [--mcts] [--nnue] [--stats] [--counters] [--verify] [--positions FILE] [--depth D] [--nodes N] [--threads N] [--eval-cache MB]" << std::endl;
+            return 84;
+        }
+    }
+    if (verify) {
+        std::mt19937 random(20);
+        return (verifyBoardSize<15>(random) && verifyBoardSize<20>(random) && verifySearches()) ? 0 : 1;
+    }
+    if (mode == SearchMode::MCTS && !nodesGiven) {
+        limits.nodes = DEFAULT_MCTS_PLAYOUTS;
+    }
+
+    Board<20> board;
+    static AI<20> ai;
+    ai.setSearchMode(mode);
+    ai.setEvaluation(evaluation);
+    ai.setThreads(threads);
+    ai.setEvalCacheSize(evalCacheMb);
+    ai.setLimits(limits);
+    static PruningStats pruningStats;
+    if (stats) {
+        ai.setPruningStats(&pruningStats);
+    }
+
+    bool nnue = evaluation == Evaluation::NNUE && Nnue<20>::isAvailable();
+    std::printf("%s, depth %d, nodes %lld, threads %d, eval %s, kernel %s\n",
+                mode == SearchMode::MCTS ? "mcts" : "alphabeta", limits.depth,
+                static_cast<long long>(limits.nodes), threads, nnue ? "nnue" : "patterns",
+                nnue ? Nnue<20>::getForwardName() : PatternDetector<20>::getKernelName());
+
+    PerfCounters counters;
+    PerfCounters::Sample searchCounters;
+    if (useCounters && !counters.open()) {
+        std::printf("hardware counters unavailable: %s\n", counters.getError().c_str());
+    }
+
+    int64_t totalNodes = 0;
+    int64_t cacheHits = 0;
+    int64_t cacheMisses = 0;
+    double totalSeconds = 0.0;
+    int index = 0;
+
+    for (const std::string& position : positions) {
+        Cell toMove = setupPosition(board, position);
+        ai.newGame();
+
+        auto start = std::chrono::steady_clock::now();
+        counters.start();
+        Move move = ai.findBestMove(board, toMove);
+        addSample(searchCounters, counters.stop());
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        int64_t nodes = (mode == SearchMode::MCTS) ? ai.getPlayouts() : ai.getNodesEvaluated();
+        totalNodes += nodes;
+        cacheHits += ai.getEvalCache().getHits();
+        cacheMisses += ai.getEvalCache().getMisses();
+        totalSeconds += seconds;
+
+        std::printf("position %d: move %d,%d nodes %lld time %.3fs nps %.0f\n", ++index,
+                    move.first, move.second, static_cast<long long>(nodes), seconds,
+                    seconds > 0.0 ? nodes / seconds : 0.0);
+    }
+
+    std::printf("total: nodes %lld time %.3fs nps %.0f\n", static_cast<long long>(totalNodes),
+                totalSeconds, totalSeconds > 0.0 ? totalNodes / totalSeconds : 0.0);
+    if (mode == SearchMode::ALPHA_BETA) {
+        int64_t probes = cacheHits + cacheMisses;
+        std::printf("eval cache: %zu entries, hits %lld misses %lld (%.1f%% hits)\n",
+                    ai.getEvalCache().getSize(), static_cast<long long>(cacheHits),
+                    static_cast<long long>(cacheMisses), probes > 0 ? 100.0 * cacheHits / probes : 0.0);
+    }
+    if (counters.isAvailable()) {
+        printCounters("counters per node:", searchCounters, static_cast<double>(std::max<int64_t>(totalNodes, 1)));
+    }
+    if (useCounters) {
+        benchKernels(ai, counters);
+    }
+    if (stats) {
+        printPruningStats(pruningStats);
+    }
+    return 0;
+}
@@ -0,0 +1,437 @@
+// Trainer for the evaluation network (nnue.hpp) on 20x20.
+//
+// Positions come from self-play with a noisy move-ordering policy and, with
+// --records, from game record files. Each position is labelled from the side
+// to move with a blend of the static pattern evaluation and the game result
+// (the search score replaces the static one for searched record moves).
+// The float network is trained with SGD on the 8 board symmetries, then
+// quantized and written as the generated source embedded in the engine.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "ai.hpp"
+#include "gamerecord.hpp"
+#include "nnue.hpp"
+
+namespace {
+
+constexpr int N = 20;
+using Net = Nnue<N>;
+
+constexpr int ACC = Net::ACCUMULATOR_SIZE;
+constexpr int INPUT = 2 * ACC;
+constexpr int HIDDEN = Net::HIDDEN_SIZE;
+constexpr float WEIGHT_LIMIT = 127.0f / (1 << Net::WEIGHT_SHIFT); // int8 range after scaling
+constexpr float RESULT_WEIGHT = 0.3f; // Share of the game result in the label
+constexpr int OPENING_RANDOM_MOVES = 4;
+constexpr int MAX_GAME_MOVES = 200;
+
+// One training position: cells of the side to move, then of the opponent
+struct Sample {
+    std::vector<uint16_t> own;
+    std::vector<uint16_t> opponent;
+    float target;
+};
+
+float sigmoid(float x) {
+    return 1.0f / (1.0f + std::exp(-x));
+}
+
+// Label in [0, 1] from a score (pattern units, side to move) and a result
+float makeLabel(int score, float result) {
+    float fromScore = sigmoid(static_cast<float>(score) / Net::OUTPUT_SCALE);
+    return (1.0f - RESULT_WEIGHT) * fromScore + RESULT_WEIGHT * result;
+}
+
+int staticScore(const Board<N>& board, Cell sideToMove) {
+    int black = 0;
+    int white = 0;
+    PatternDetector<N>::evaluateBoard(board, black, white);
+    return (sideToMove == Cell::BLACK) ? black - white : white - black;
+}
+
+Sample makeSample(const Board<N>& board, Cell sideToMove) {
+    Sample sample;
+    std::span<const uint16_t> own = board.getStones(sideToMove);
+    std::span<const uint16_t> opponent = board.getStones(opponentOf(sideToMove));
+    sample.own.assign(own.begin(), own.end());
+    sample.opponent.assign(opponent.begin(), opponent.end());
+    return sample;
+}
+
+float resultFor(Cell sideToMove, Cell winner) {
+    return winner == Cell::EMPTY ? 0.5f : (winner == sideToMove ? 1.0f : 0.0f);
+}
+
+// Self-play: a few random opening moves, then mostly the best ordered move
+void generateGames(int games, std::mt19937& rng, std::vector<Sample>& samples) {
+    static AI<N> ai;
+    Board<N> board;
+    MoveList moves;
+    std::vector<std::pair<Cell, int>> scores; // Side to move, static score
+
+    for (int game = 0; game < games; game++) {
+        board.clear();
+        std::vector<Sample> gameSamples;
+        scores.clear();
+        Cell toMove = Cell::BLACK;
+        Cell winner = Cell::EMPTY;
+
+        for (int ply = 0; ply < MAX_GAME_MOVES; ply++) {
+            Move move;
+            if (ply < OPENING_RANDOM_MOVES) {
+                std::uniform_int_distribution<int> offset(-3, 3);
+                do {
+                    move = Move(N / 2 + offset(rng), N / 2 + offset(rng));
+                } while (!board.isValidMove(move.first, move.second));
+            } else {
+                ai.getOrderedMovesAdvanced(board, toMove, moves);
+                if (moves.empty()) {
+                    break;
+                }
+                int candidates = std::min(moves.size(), 4);
+                int pick = (rng() % 4 == 0) ? static_cast<int>(rng() % candidates) : 0;
+                move = moves[pick];
+
+                gameSamples.push_back(makeSample(board, toMove));
+                scores.emplace_back(toMove, staticScore(board, toMove));
+            }
+
+            board.placeStone(move.first, move.second, toMove);
+            if (board.checkWin(move.first, move.second, toMove)) {
+                winner = toMove;
+                break;
+            }
+            toMove = opponentOf(toMove);
+        }
+
+        for (size_t i = 0; i < gameSamples.size(); i++) {
+            gameSamples[i].target = makeLabel(scores[i].second, resultFor(scores[i].first, winner));
+            samples.push_back(std::move(gameSamples[i]));
+        }
+    }
+}
+
+// Every position of every 20x20 game in a record file
+bool loadRecords(const std::string& path, std::vector<Sample>& samples) {
+    GameRecordReader reader;
+    if (!reader.open(path)) {
+        return false;
+    }
+
+    GameRecordView record;
+    Board<N> board;
+    while (reader.next(record)) {
+        if (record.getBoardSize() != N) {
+            continue;
+        }
+        GameResult result = record.getResult();
+        Cell winner = (result == GameResult::BLACK_WIN) ? Cell::BLACK :
+                      (result == GameResult::WHITE_WIN) ? Cell::WHITE : Cell::EMPTY;
+        bool decided = result != GameResult::UNKNOWN;
+
+        board.clear();
+        Cell toMove = Cell::BLACK;
+        for (int i = 0; i < record.getMoveCount(); i++) {
+            Move move = record.getMove(i);
+            int score = record.getDepth(i) > 0 ? record.getScore(i) : staticScore(board, toMove);
+            Sample sample = makeSample(board, toMove);
+            float outcome = decided ? resultFor(toMove, winner) : sigmoid(static_cast<float>(score) / Net::OUTPUT_SCALE);
+            sample.target = makeLabel(score, outcome);
+            samples.push_back(std::move(sample));
+
+            if (!board.placeStone(move.first, move.second, toMove)) {
+                break;
+            }
+            toMove = opponentOf(toMove);
+        }
+    }
+    return true;
+}
+
+// Cell under one of the 8 symmetries of the square
+uint16_t transformCell(uint16_t cell, int symmetry) {
+    int x = cell % N;
+    int y = cell / N;
+    if (symmetry & 1) x = N - 1 - x;
+    if (symmetry & 2) y = N - 1 - y;
+    if (symmetry & 4) std::swap(x, y);
+    return static_cast<uint16_t>(y * N + x);
+}
+
+// Float network with the same shape as Nnue<N>
+struct FloatNetwork {
+    std::vector<float> featureWeights; // [feature][ACC], feature = own cells then opponent cells
+    std::vector<float> featureBias;
+    std::vector<float> hiddenWeights;  // [HIDDEN][INPUT]
+    std::vector<float> hiddenBias;
+    std::vector<float> outputWeights;
+    float outputBias = 0.0f;
+
+    explicit FloatNetwork(std::mt19937& rng)
+        : featureWeights(static_cast<size_t>(Net::FEATURE_COUNT) * ACC), featureBias(ACC, 0.1f),
+          hiddenWeights(HIDDEN * INPUT), hiddenBias(HIDDEN, 0.0f), outputWeights(HIDDEN) {
+        std::uniform_real_distribution<float> small(-0.1f, 0.1f);
+        std::uniform_real_distribution<float> hidden(-0.3f, 0.3f);
+        for (float& w : featureWeights) w = small(rng);
+        for (float& w : hiddenWeights) w = hidden(rng);
+        for (float& w : outputWeights) w = hidden(rng);
+    }
+};
+
+// Intermediate values of one forward pass, kept for the backward pass
+struct Activations {
+    float accumulator[2][ACC];
+    float input[INPUT];
+    float hiddenSum[HIDDEN];
+    float hidden[HIDDEN];
+    float output;
+};
+
+void accumulate(const FloatNetwork& net, const std::vector<uint16_t>& own, const std::vector<uint16_t>& opponent,
+                int symmetry, float* accumulator) {
+    std::copy(net.featureBias.begin(), net.featureBias.end(), accumulator);
+    for (uint16_t cell : own) {
+        const float* column = &net.featureWeights[transformCell(cell, symmetry) * ACC];
+        for (int i = 0; i < ACC; i++) accumulator[i] += column[i];
+    }
+    for (uint16_t cell : opponent) {
+        const float* column = &net.featureWeights[(N * N + transformCell(cell, symmetry)) * ACC];
+        for (int i = 0; i < ACC; i++) accumulator[i] += column[i];
+    }
+}
+
+void forward(const FloatNetwork& net, const Sample& sample, int symmetry, Activations& a) {
+    accumulate(net, sample.own, sample.opponent, symmetry, a.accumulator[0]);
+    accumulate(net, sample.opponent, sample.own, symmetry, a.accumulator[1]);
+    for (int i = 0; i < ACC; i++) {
+        a.input[i] = std::clamp(a.accumulator[0][i], 0.0f, 1.0f);
+        a.input[ACC + i] = std::clamp(a.accumulator[1][i], 0.0f, 1.0f);
+    }
+
+    a.output = net.outputBias;
+    for (int j = 0; j < HIDDEN; j++) {
+        float sum = net.hiddenBias[j];
+        for (int i = 0; i < INPUT; i++) {
+            sum += net.hiddenWeights[j * INPUT + i] * a.input[i];
+        }
+        a.hiddenSum[j] = sum;
+        a.hidden[j] = std::clamp(sum, 0.0f, 1.0f);
+        a.output += net.outputWeights[j] * a.hidden[j];
+    }
+}
+
+void addToColumns(FloatNetwork& net, const std::vector<uint16_t>& own, const std::vector<uint16_t>& opponent,
+                  int symmetry, const float* gradient) {
+    for (uint16_t cell : own) {
+        float* column = &net.featureWeights[transformCell(cell, symmetry) * ACC];
+        for (int i = 0; i < ACC; i++) column[i] = std::clamp(column[i] - gradient[i], -2.0f, 2.0f);
+    }
+    for (uint16_t cell : opponent) {
+        float* column = &net.featureWeights[(N * N + transformCell(cell, symmetry)) * ACC];
+        for (int i = 0; i < ACC; i++) column[i] = std::clamp(column[i] - gradient[i], -2.0f, 2.0f);
+    }
+}
+
+// One SGD step on the squared error of sigmoid(output), returns the loss
+float trainStep(FloatNetwork& net, const Sample& sample, int symmetry, float rate) {
+    Activations a;
+    forward(net, sample, symmetry, a);
+
+    float predicted = sigmoid(a.output);
+    float error = predicted - sample.target;
+    float outputGradient = 2.0f * error * predicted * (1.0f - predicted) * rate;
+
+    float inputGradient[INPUT] = {};
+    for (int j = 0; j < HIDDEN; j++) {
+        float hiddenGradient = (a.hiddenSum[j] > 0.0f && a.hiddenSum[j] < 1.0f) ? outputGradient * net.outputWeights[j] : 0.0f;
+        net.outputWeights[j] = std::clamp(net.outputWeights[j] - outputGradient * a.hidden[j], -WEIGHT_LIMIT, WEIGHT_LIMIT);
+        if (hiddenGradient == 0.0f) {
+            continue;
+        }
+        float* row = &net.hiddenWeights[j * INPUT];
+        for (int i = 0; i < INPUT; i++) {
+            inputGradient[i] += hiddenGradient * row[i];
+            row[i] = std::clamp(row[i] - hiddenGradient * a.input[i], -WEIGHT_LIMIT, WEIGHT_LIMIT);
+        }
+        net.hiddenBias[j] -= hiddenGradient;
+    }
+    net.outputBias -= outputGradient;
+
+    // Back through the clipped ReLU into both perspectives' accumulators
+    float gradient[2][ACC];
+    for (int p = 0; p < 2; p++) {
+        for (int i = 0; i < ACC; i++) {
+            float value = a.accumulator[p][i];
+            gradient[p][i] = (value > 0.0f && value < 1.0f) ? inputGradient[p * ACC + i] : 0.0f;
+        }
+    }
+    for (int i = 0; i < ACC; i++) {
+        net.featureBias[i] -= gradient[0][i] + gradient[1][i];
+    }
+    addToColumns(net, sample.own, sample.opponent, symmetry, gradient[0]);
+    addToColumns(net, sample.opponent, sample.own, symmetry, gradient[1]);
+
+    return error * error;
+}
+
+int quantize(float value, float scale, int limit) {
+    return std::clamp(static_cast<int>(std::lround(value * scale)), -limit, limit);
+}
+
+Net::Weights quantizeNetwork(const FloatNetwork& net) {
+    const float activation = Net::ACTIVATION_MAX;
+    const float weight = 1 << Net::WEIGHT_SHIFT;
+    Net::Weights q;
+
+    q.featureWeights.resize(net.featureWeights.size());
+    for (size_t i = 0; i < net.featureWeights.size(); i++) {
+        q.featureWeights[i] = static_cast<int16_t>(quantize(net.featureWeights[i], activation, 32767));
+    }
+    for (int i = 0; i < ACC; i++) {
+        q.featureBias[i] = static_cast<int16_t>(quantize(net.featureBias[i], activation, 32767));
+    }
+    for (int i = 0; i < HIDDEN * INPUT; i++) {
+        q.hiddenWeights[i] = static_cast<int8_t>(quantize(net.hiddenWeights[i], weight, 127));
+    }
+    for (int j = 0; j < HIDDEN; j++) {
+        q.hiddenBias[j] = quantize(net.hiddenBias[j], weight * activation, 1 << 30);
+        q.outputWeights[j] = static_cast<int8_t>(quantize(net.outputWeights[j], weight, 127));
+    }
+    q.outputBias = quantize(net.outputBias, weight * activation, 1 << 30);
+    q.loaded = true;
+    return q;
+}
+
+// Mean squared error of the quantized network, evaluated through Board
+float quantizedLoss(const std::vector<Sample>& samples) {
+    Board<N> board;
+    double total = 0.0;
+    for (const Sample& sample : samples) {
+        board.clear();
+        for (uint16_t cell : sample.own) board.placeStone(cell % N, cell / N, Cell::BLACK);
+        for (uint16_t cell : sample.opponent) board.placeStone(cell % N, cell / N, Cell::WHITE);
+        float predicted = sigmoid(static_cast<float>(Net::evaluate(board, Cell::BLACK)) / Net::OUTPUT_SCALE);
+        total += (predicted - sample.target) * (predicted - sample.target);
+    }
+    return samples.empty() ? 0.0f : static_cast<float>(total / samples.size());
+}
+
+bool writeWeightsSource(const std::string& path, const Net::Weights& weights, long samples) {
+    std::ofstream out(path);
+    if (!out) {
+        return false;
+    }
+    std::string blob = Net::encodeBlob(weights);
+    out << "// Generated by gomoku-nnue-train (" << samples << " positions), do not edit.\n"
+        << "#include \"nnue.hpp\"\n\n"
+        << "const NnueBlob NNUE_BLOBS[] = {\n"
+        << "    {" << N << ",\n";
+    const size_t lineLength = 96;
+    for (size_t i = 0; i < blob.size(); i += lineLength) {
+        out << "     \"" << blob.substr(i, lineLength) << "\"" << (i + lineLength >= blob.size() ? "},\n" : "\n");
+    }
+    out << "};\n\n"
+        << "const int NNUE_BLOB_COUNT = sizeof(NNUE_BLOBS) / sizeof(NNUE_BLOBS[0]);\n";
+    return static_cast<bool>(out);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int games = 2000;
+    int epochs = 12;
+    unsigned seed = 1;
+    float rate = 0.02f;
+    std::string output = "src/nnue_weights.cpp";
+    std::vector<std::string> recordFiles;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        try {
+            if (arg == "--games" && i + 1 < argc) {
+                games = std::stoi(argv[++i]);
+            } else if (arg == "--epochs" && i + 1 < argc) {
+                epochs = std::stoi(argv[++i]);
+            } else if (arg == "--seed" && i + 1 < argc) {
+                seed = static_cast<unsigned>(std::stoul(argv[++i]));
+            } else if (arg == "--rate" && i + 1 < argc) {
+                rate = std::stof(argv[++i]);
+            } else if (arg == "--records" && i + 1 < argc) {
+                recordFiles.push_back(argv[++i]);
+            } else if (arg == "--output" && i + 1 < argc) {
+                output = argv[++i];
+            } else {
+                throw std::invalid_argument(arg);
+            }
+        } catch (const std::exception&) {
+            std::cerr << "Usage: " << argv[0] << " [--games N] [--records FILE]... [--epochs E]"
+                      << " [--rate R] [--seed S] [--output FILE]" << std::endl;
+            return 84;
+        }
+    }
+
+    std::mt19937 rng(seed);
+    std::vector<Sample> samples;
+    auto start = std::chrono::steady_clock::now();
+
+    generateGames(games, rng, samples);
+    for (const std::string& path : recordFiles) {
+        if (!loadRecords(path, samples)) {
+            std::cerr << "Cannot read game records from " << path << std::endl;
+            return 84;
+        }
+    }
+    if (samples.size() < 100) {
+        std::cerr << "Not enough positions (" << samples.size() << ")" << std::endl;
+        return 84;
+    }
+
+    // Hold out every 20th position for validation
+    std::shuffle(samples.begin(), samples.end(), rng);
+    std::vector<Sample> validation(samples.end() - samples.size() / 20, samples.end());
+    samples.resize(samples.size() - validation.size());
+    std::printf("positions: %zu training, %zu validation (%.1fs)\n", samples.size(), validation.size(),
+                std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+    FloatNetwork net(rng);
+    std::vector<size_t> order(samples.size());
+    for (size_t i = 0; i < order.size(); i++) order[i] = i;
+
+    for (int epoch = 0; epoch < epochs; epoch++) {
+        std::shuffle(order.begin(), order.end(), rng);
+        float epochRate = rate * (1.0f - 0.9f * epoch / std::max(1, epochs - 1));
+        double loss = 0.0;
+        for (size_t i : order) {
+            loss += trainStep(net, samples[i], static_cast<int>(rng() & 7), epochRate);
+        }
+
+        double validationLoss = 0.0;
+        Activations a;
+        for (const Sample& sample : validation) {
+            forward(net, sample, 0, a);
+            float error = sigmoid(a.output) - sample.target;
+            validationLoss += error * error;
+        }
+        std::printf("epoch %d: rate %.4f train %.5f validation %.5f\n", epoch + 1, epochRate,
+                    loss / samples.size(), validationLoss / validation.size());
+    }
+
+    Net::Weights weights = quantizeNetwork(net);
+    Net::setWeights(weights);
+    std::printf("quantized validation %.5f (forward %s)\n", quantizedLoss(validation), Net::getForwardName());
+
+    if (!writeWeightsSource(output, weights, static_cast<long>(samples.size()))) {
+        std::cerr << "Cannot write " << output << std::endl;
+        return 84;
+    }
+    std::printf("wrote %s\n", output.c_str());
+    return 0;
+}
@@ -0,0 +1,169 @@
+#ifndef PERFCOUNTERS_HPP
+#define PERFCOUNTERS_HPP
+
+// Hardware counters for gomoku-bench through Linux perf_event_open, counting
+// this process in user space only. Each counter is opened on its own, so a
+// machine (or VM) missing one event still reports the others; elsewhere, or
+// when perf_event_paranoid forbids it, nothing is available and the bench
+// says so instead of failing.
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#ifdef __linux__
+#include <cerrno>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+class PerfCounters {
+    public:
+        enum Event {
+            CYCLES,
+            INSTRUCTIONS,
+            L1D_MISSES,
+            LLC_MISSES,
+            BRANCH_MISSES,
+            DTLB_MISSES,
+            EVENT_COUNT
+        };
+
+        // Counts since start(), scaled when the kernel multiplexed a counter
+        struct Sample {
+            std::array<double, EVENT_COUNT> values{};
+            std::array<bool, EVENT_COUNT> valid{};
+        };
+
+    private:
+        std::array<int, EVENT_COUNT> fds;
+        std::string error; // Why the first counter could not be opened
+
+    public:
+        PerfCounters() { fds.fill(-1); }
+        ~PerfCounters() { close(); }
+        PerfCounters(const PerfCounters&) = delete;
+        PerfCounters& operator=(const PerfCounters&) = delete;
+
+        static const char* getName(int event) {
+            static const char* names[EVENT_COUNT] = {
+                "cycles", "instructions", "L1d-misses", "LLC-misses", "branch-misses", "dTLB-misses"
+            };
+            return names[event];
+        }
+
+        // True when at least one counter opened
+        bool open() {
+            close();
+#ifdef __linux__
+            for (int event = 0; event < EVENT_COUNT; event++) {
+                perf_event_attr attr;
+                std::memset(&attr, 0, sizeof(attr));
+                attr.size = sizeof(attr);
+                configure(event, attr);
+                attr.disabled = 1;
+                attr.exclude_kernel = 1;
+                attr.exclude_hv = 1;
+                attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+                long fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+                if (fd < 0 && error.empty()) {
+                    error = std::strerror(errno);
+                }
+                fds[event] = static_cast<int>(fd);
+            }
+#else
+            error = "perf_event_open needs Linux";
+#endif
+            return isAvailable();
+        }
+
+        void close() {
+#ifdef __linux__
+            for (int& fd : fds) {
+                if (fd >= 0) {
+                    ::close(fd);
+                }
+                fd = -1;
+            }
+#endif
+        }
+
+        bool isAvailable() const {
+            for (int fd : fds) {
+                if (fd >= 0) {
+                    return true;
+                }
+            }
+            return false;
+        }
+        const std::string& getError() const { return error; }
+
+        void start() {
+#ifdef __linux__
+            for (int fd : fds) {
+                if (fd >= 0) {
+                    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                    ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+                }
+            }
+#endif
+        }
+
+        Sample stop() {
+            Sample sample;
+#ifdef __linux__
+            for (int event = 0; event < EVENT_COUNT; event++) {
+                if (fds[event] < 0) {
+                    continue;
+                }
+                ioctl(fds[event], PERF_EVENT_IOC_DISABLE, 0);
+
+                uint64_t data[3]; // value, time enabled, time running
+                if (read(fds[event], data, sizeof(data)) == static_cast<ssize_t>(sizeof(data)) && data[2] > 0) {
+                    sample.values[event] = static_cast<double>(data[0]) * data[1] / data[2];
+                    sample.valid[event] = true;
+                }
+            }
+#endif
+            return sample;
+        }
+
+    private:
+#ifdef __linux__
+        static void configure(int event, perf_event_attr& attr) {
+            auto cache = [](uint64_t cacheId, uint64_t op) {
+                return cacheId | (op << 8) | (static_cast<uint64_t>(PERF_COUNT_HW_CACHE_RESULT_MISS) << 16);
+            };
+
+            attr.type = PERF_TYPE_HARDWARE;
+            switch (event) {
+                case CYCLES:
+                    attr.config = PERF_COUNT_HW_CPU_CYCLES;
+                    break;
+                case INSTRUCTIONS:
+                    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+                    break;
+                case L1D_MISSES:
+                    attr.type = PERF_TYPE_HW_CACHE;
+                    attr.config = cache(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ);
+                    break;
+                case LLC_MISSES:
+                    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+                    break;
+                case BRANCH_MISSES:
+                    attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+                    break;
+                case DTLB_MISSES:
+                    attr.type = PERF_TYPE_HW_CACHE;
+                    attr.config = cache(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_OP_READ);
+                    break;
+            }
+        }
+#endif
+};
+
+#endif // PERFCOUNTERS_HPP
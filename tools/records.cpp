@@ -0,0 +1,65 @@
+// Game record inspection: summary of a record file, or every game printed
+// as a position line that --analyze accepts (size, then moves).
+
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include "gamerecord.hpp"
+
+static const char* resultName(GameResult result) {
+    switch (result) {
+        case GameResult::BLACK_WIN: return "black";
+        case GameResult::WHITE_WIN: return "white";
+        case GameResult::DRAW: return "draw";
+        default: return "unknown";
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2 || argc > 3 || (argc == 3 && std::string(argv[2]) != "--positions" &&
+                                 std::string(argv[2]) != "--games")) {
+        std::cerr << "Usage: " << argv[0] << " FILE [--games | --positions]" << std::endl;
+        return 84;
+    }
+
+    GameRecordReader reader;
+    if (!reader.open(argv[1])) {
+        std::cerr << "Cannot read game records from " << argv[1] << std::endl;
+        return 84;
+    }
+    std::string mode = (argc == 3) ? argv[2] : "";
+
+    long games = 0;
+    long moves = 0;
+    long results[4] = {0, 0, 0, 0};
+    GameRecordView record;
+
+    while (reader.next(record)) {
+        games++;
+        moves += record.getMoveCount();
+        results[static_cast<int>(record.getResult()) & 3]++;
+
+        if (mode == "--positions") {
+            std::printf("%d", record.getBoardSize());
+            for (int i = 0; i < record.getMoveCount(); i++) {
+                Move move = record.getMove(i);
+                std::printf(" %d,%d", move.first, move.second);
+            }
+            std::printf("\n");
+        } else if (mode == "--games") {
+            std::printf("game %ld: size %d result %s moves %d\n", games, record.getBoardSize(),
+                        resultName(record.getResult()), record.getMoveCount());
+            for (int i = 0; i < record.getMoveCount(); i++) {
+                Move move = record.getMove(i);
+                std::printf("  %3d %2d,%-2d depth %2d score %7d time %5dms\n", i + 1, move.first,
+                            move.second, record.getDepth(i), record.getScore(i), record.getTimeMs(i));
+            }
+        }
+    }
+
+    if (mode.empty()) {
+        std::printf("games %ld moves %ld black %ld white %ld draw %ld unknown %ld\n", games, moves,
+                    results[1], results[2], results[3], results[0]);
+    }
+    return 0;
+}
@@ -0,0 +1,404 @@
+// Texel-style tuner for the pattern evaluation (include/pattern_weights.hpp).
+//
+// Every position of every decided game in the record files is replayed and
+// reduced to its pattern counts (countLinePatterns) for the side to move and
+// for the opponent, labelled with the game result from the side to move.
+// Openings (--skip) and positions where a five can be made are left out:
+// the static evaluation does not decide those. The model is the engine's
+//
+//   eval = sum over t of PATTERN_WEIGHTS[t] * (own[t] - DEFENSE_WEIGHT * opponent[t])
+//
+// mapped to a win probability by sigmoid(eval / scale). The scale is fitted
+// first with the current weights, then the weights (in log space) and the
+// defense weight by full-batch Adam on the mean squared error. Only the
+// pattern types seen in the samples are tuned (fives and fours never are),
+// and since the data fixes them only up to a common factor, they are scaled
+// back at the end so the largest keeps its current value: the search's
+// margins and the threat weights stay on the same scale. Position extraction
+// and every gradient are split across all threads.
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "board.hpp"
+#include "gamerecord.hpp"
+#include "pattern.hpp"
+
+namespace {
+
+constexpr int TYPES = PATTERN_TYPE_COUNT;
+constexpr int PARAMETERS = TYPES + 1; // Log weights, then log defense weight
+constexpr int VALIDATION_EVERY = 20;  // Games held out for validation: one in 20
+
+// One labelled position
+struct Sample {
+    std::array<uint16_t, TYPES> own;      // Pattern counts of the side to move
+    std::array<uint16_t, TYPES> opponent;
+    float result;                         // 1 win, 0.5 draw, 0 loss for the side to move
+};
+
+struct Model {
+    std::array<double, PARAMETERS> parameters; // log(weight) per type, log(defense)
+    double scale;
+
+    double weight(int type) const { return std::exp(parameters[type]); }
+    double defense() const { return std::exp(parameters[TYPES]); }
+};
+
+// Sums over a range of samples
+struct Gradient {
+    double loss = 0.0;
+    std::array<double, PARAMETERS> parameters{};
+
+    void add(const Gradient& other) {
+        loss += other.loss;
+        for (int i = 0; i < PARAMETERS; i++) {
+            parameters[i] += other.parameters[i];
+        }
+    }
+};
+
+double sigmoid(double x) {
+    return 1.0 / (1.0 + std::exp(-x));
+}
+
+// A five can be made by either side: a tactical position (such a cell is at
+// most 4 away from the stones)
+template <int N>
+bool hasFiveThreat(const Board<N>& board) {
+    BoardArea area = board.getStoneArea(4);
+    for (int y = area.minY; y <= area.maxY; y++) {
+        for (int x = area.minX; x <= area.maxX; x++) {
+            if (board.getCell(x, y) == Cell::EMPTY &&
+                ((board.getThreats(x, y, Cell::BLACK) | board.getThreats(x, y, Cell::WHITE)) & THREAT_FIVE)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// Replay one game into samples
+template <int N>
+void extractGame(const GameRecordView& record, int skip, std::vector<Sample>& out) {
+    GameResult result = record.getResult();
+    Cell winner = (result == GameResult::BLACK_WIN) ? Cell::BLACK :
+                  (result == GameResult::WHITE_WIN) ? Cell::WHITE : Cell::EMPTY;
+
+    Board<N> board;
+    Cell toMove = Cell::BLACK;
+    int counts[2][TYPES];
+    for (int i = 0; i < record.getMoveCount(); i++) {
+        if (i >= skip && !hasFiveThreat(board)) {
+            PatternDetector<N>::countLinePatterns(board, counts);
+            int own = (toMove == Cell::BLACK) ? 0 : 1;
+            Sample sample;
+            for (int t = 0; t < TYPES; t++) {
+                sample.own[t] = static_cast<uint16_t>(counts[own][t]);
+                sample.opponent[t] = static_cast<uint16_t>(counts[1 - own][t]);
+            }
+            sample.result = (winner == Cell::EMPTY) ? 0.5f : (winner == toMove ? 1.0f : 0.0f);
+            out.push_back(sample);
+        }
+
+        Move move = record.getMove(i);
+        if (!board.placeStone(move.first, move.second, toMove)) {
+            break;
+        }
+        toMove = opponentOf(toMove);
+    }
+}
+
+void extractRecord(const GameRecordView& record, int skip, std::vector<Sample>& out) {
+    if (record.getBoardSize() == 15) {
+        extractGame<15>(record, skip, out);
+    } else if (record.getBoardSize() == 20) {
+        extractGame<20>(record, skip, out);
+    }
+}
+
+// Run work(thread, begin, end) over [0, count) split in one slice per thread
+template <typename Work>
+void parallelFor(int threads, size_t count, Work work) {
+    std::vector<std::thread> pool;
+    for (int i = 0; i < threads; i++) {
+        size_t begin = count * i / threads;
+        size_t end = count * (i + 1) / threads;
+        pool.emplace_back(work, i, begin, end);
+    }
+    for (std::thread& thread : pool) {
+        thread.join();
+    }
+}
+
+// Loss and gradient of samples[begin, end) (mean squared error, summed)
+Gradient computeGradient(const Model& model, const std::vector<Sample>& samples, size_t begin, size_t end) {
+    std::array<double, TYPES> weights;
+    for (int t = 0; t < TYPES; t++) {
+        weights[t] = model.weight(t);
+    }
+    double defense = model.defense();
+
+    Gradient gradient;
+    for (size_t i = begin; i < end; i++) {
+        const Sample& sample = samples[i];
+        double own = 0.0;
+        double opponent = 0.0;
+        std::array<double, TYPES> terms;
+        for (int t = 0; t < TYPES; t++) {
+            terms[t] = weights[t] * (sample.own[t] - defense * sample.opponent[t]);
+            own += weights[t] * sample.own[t];
+            opponent += weights[t] * sample.opponent[t];
+        }
+        double probability = sigmoid((own - defense * opponent) / model.scale);
+        double error = probability - sample.result;
+        gradient.loss += error * error;
+
+        // d loss / d eval, then the chain rule through the log parameters
+        double slope = 2.0 * error * probability * (1.0 - probability) / model.scale;
+        for (int t = 0; t < TYPES; t++) {
+            gradient.parameters[t] += slope * terms[t];
+        }
+        gradient.parameters[TYPES] -= slope * defense * opponent;
+    }
+    return gradient;
+}
+
+Gradient parallelGradient(const Model& model, const std::vector<Sample>& samples, int threads) {
+    std::vector<Gradient> partial(threads);
+    parallelFor(threads, samples.size(), [&](int thread, size_t begin, size_t end) {
+        partial[thread] = computeGradient(model, samples, begin, end);
+    });
+
+    Gradient total;
+    for (const Gradient& gradient : partial) {
+        total.add(gradient);
+    }
+    double count = static_cast<double>(std::max<size_t>(samples.size(), 1));
+    total.loss /= count;
+    for (double& value : total.parameters) {
+        value /= count;
+    }
+    return total;
+}
+
+// Golden-section search of the scale (in log space) for the current weights
+void fitScale(Model& model, const std::vector<Sample>& samples, int threads) {
+    const double ratio = (std::sqrt(5.0) - 1.0) / 2.0;
+    double low = std::log(100.0);
+    double high = std::log(1000000.0);
+    auto lossAt = [&](double logScale) {
+        Model trial = model;
+        trial.scale = std::exp(logScale);
+        return parallelGradient(trial, samples, threads).loss;
+    };
+
+    double a = high - ratio * (high - low);
+    double b = low + ratio * (high - low);
+    double lossA = lossAt(a);
+    double lossB = lossAt(b);
+    for (int i = 0; i < 40; i++) {
+        if (lossA < lossB) {
+            high = b;
+            b = a;
+            lossB = lossA;
+            a = high - ratio * (high - low);
+            lossA = lossAt(a);
+        } else {
+            low = a;
+            a = b;
+            lossA = lossB;
+            b = low + ratio * (high - low);
+            lossB = lossAt(b);
+        }
+    }
+    model.scale = std::exp((low + high) / 2.0);
+}
+
+bool writeWeightsHeader(const std::string& path, const Model& model, size_t samples, double loss) {
+    std::ofstream out(path);
+    if (!out) {
+        return false;
+    }
+    out << "#ifndef PATTERN_WEIGHTS_HPP\n"
+        << "#define PATTERN_WEIGHTS_HPP\n\n"
+        << "// Evaluation weights: pattern scores in PatternType order (FIVE first) and\n"
+        << "// the weight of the opponent's patterns (defense). Generated by gomoku-tune\n"
+        << "// from " << samples << " positions (validation loss " << loss << "), do not edit.\n\n"
+        << "inline constexpr int PATTERN_WEIGHTS[] = {";
+    for (int t = 0; t < TYPES; t++) {
+        long weight = std::max(1L, std::lround(model.weight(t)));
+        out << (t > 0 ? ", " : "") << weight;
+    }
+    char defense[32];
+    std::snprintf(defense, sizeof(defense), "%.3f", model.defense());
+    out << "};\n"
+        << "inline constexpr double DEFENSE_WEIGHT = " << defense << ";\n\n"
+        << "#endif // PATTERN_WEIGHTS_HPP\n";
+    return static_cast<bool>(out);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int epochs = 300;
+    int skip = 6;
+    int threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    double rate = 0.05;
+    std::string output = "include/pattern_weights.hpp";
+    std::vector<std::string> recordFiles;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        try {
+            if (arg == "--records" && i + 1 < argc) {
+                while (i + 1 < argc && std::string(argv[i + 1]).rfind("--", 0) != 0) {
+                    recordFiles.push_back(argv[++i]);
+                }
+            } else if (arg == "--epochs" && i + 1 < argc) {
+                epochs = std::stoi(argv[++i]);
+            } else if (arg == "--rate" && i + 1 < argc) {
+                rate = std::stod(argv[++i]);
+            } else if (arg == "--skip" && i + 1 < argc) {
+                skip = std::stoi(argv[++i]);
+            } else if (arg == "--threads" && i + 1 < argc) {
+                threads = std::max(1, std::stoi(argv[++i]));
+            } else if (arg == "--output" && i + 1 < argc) {
+                output = argv[++i];
+            } else {
+                throw std::invalid_argument(arg);
+            }
+        } catch (const std::exception&) {
+            recordFiles.clear();
+            break;
+        }
+    }
+    if (recordFiles.empty()) {
+        std::cerr << "Usage: " << argv[0] << " --records FILE... [--epochs E] [--rate R]"
+                  << " [--skip MOVES] [--threads N] [--output FILE]" << std::endl;
+        return 84;
+    }
+
+    // Index every decided game, then replay them on all threads
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::unique_ptr<GameRecordReader>> readers;
+    std::vector<GameRecordView> games;
+    for (const std::string& path : recordFiles) {
+        readers.push_back(std::make_unique<GameRecordReader>());
+        if (!readers.back()->open(path)) {
+            std::cerr << "Cannot read game records from " << path << std::endl;
+            return 84;
+        }
+        for (size_t offset : readers.back()->buildIndex()) {
+            GameRecordView record = readers.back()->recordAt(offset);
+            if (record.getResult() != GameResult::UNKNOWN) {
+                games.push_back(record);
+            }
+        }
+    }
+
+    std::vector<std::vector<Sample>> training(threads);
+    std::vector<std::vector<Sample>> validation(threads);
+    parallelFor(threads, games.size(), [&](int thread, size_t begin, size_t end) {
+        for (size_t game = begin; game < end; game++) {
+            bool heldOut = game % VALIDATION_EVERY == VALIDATION_EVERY - 1;
+            extractRecord(games[game], skip, heldOut ? validation[thread] : training[thread]);
+        }
+    });
+    std::vector<Sample> samples;
+    std::vector<Sample> validationSamples;
+    for (int i = 0; i < threads; i++) {
+        samples.insert(samples.end(), training[i].begin(), training[i].end());
+        validationSamples.insert(validationSamples.end(), validation[i].begin(), validation[i].end());
+    }
+    if (samples.size() < 100) {
+        std::cerr << "Not enough positions (" << samples.size() << ")" << std::endl;
+        return 84;
+    }
+    std::printf("positions: %zu training, %zu validation from %zu games, %d threads (%.1fs)\n",
+                samples.size(), validationSamples.size(), games.size(), threads,
+                std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+    Model model;
+    std::array<bool, PARAMETERS> tuned{};
+    for (int t = 0; t < TYPES; t++) {
+        model.parameters[t] = std::log(static_cast<double>(PATTERN_WEIGHTS[t]));
+        tuned[t] = std::any_of(samples.begin(), samples.end(), [t](const Sample& sample) {
+            return sample.own[t] || sample.opponent[t];
+        });
+    }
+    tuned[TYPES] = true;
+    model.parameters[TYPES] = std::log(DEFENSE_WEIGHT);
+    fitScale(model, samples, threads);
+    double initialLoss = parallelGradient(model, samples, threads).loss;
+    std::printf("scale %.0f: train %.5f validation %.5f\n", model.scale, initialLoss,
+                parallelGradient(model, validationSamples, threads).loss);
+
+    // Adam on the log parameters of the tuned types
+    const double beta1 = 0.9;
+    const double beta2 = 0.999;
+    std::array<double, PARAMETERS> moment{};
+    std::array<double, PARAMETERS> velocity{};
+    auto epochStart = std::chrono::steady_clock::now();
+    for (int epoch = 1; epoch <= epochs; epoch++) {
+        Gradient gradient = parallelGradient(model, samples, threads);
+        for (int i = 0; i < PARAMETERS; i++) {
+            if (!tuned[i]) {
+                continue;
+            }
+            moment[i] = beta1 * moment[i] + (1.0 - beta1) * gradient.parameters[i];
+            velocity[i] = beta2 * velocity[i] + (1.0 - beta2) * gradient.parameters[i] * gradient.parameters[i];
+            double corrected = moment[i] / (1.0 - std::pow(beta1, epoch));
+            double spread = std::sqrt(velocity[i] / (1.0 - std::pow(beta2, epoch)));
+            model.parameters[i] -= rate * corrected / (spread + 1e-12);
+        }
+
+        if (epoch % 50 == 0 || epoch == epochs) {
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - epochStart).count();
+            std::printf("epoch %d: train %.5f validation %.5f (%.0f positions/s)\n", epoch, gradient.loss,
+                        parallelGradient(model, validationSamples, threads).loss,
+                        seconds > 0.0 ? samples.size() * static_cast<double>(epoch) / seconds : 0.0);
+        }
+    }
+
+    // Back to the engine's scale (weights and scale together: same loss)
+    double largestTuned = 0.0;
+    double largestCurrent = 0.0;
+    for (int t = 0; t < TYPES; t++) {
+        if (tuned[t]) {
+            largestTuned = std::max(largestTuned, model.weight(t));
+            largestCurrent = std::max(largestCurrent, static_cast<double>(PATTERN_WEIGHTS[t]));
+        }
+    }
+    if (largestTuned > 0.0) {
+        double factor = largestCurrent / largestTuned;
+        for (int t = 0; t < TYPES; t++) {
+            if (tuned[t]) {
+                model.parameters[t] += std::log(factor);
+            }
+        }
+        model.scale *= factor;
+    }
+
+    double validationLoss = parallelGradient(model, validationSamples, threads).loss;
+    std::printf("weights:");
+    for (int t = 0; t < TYPES; t++) {
+        std::printf(" %.0f", model.weight(t));
+    }
+    std::printf(" defense %.3f\n", model.defense());
+
+    if (!writeWeightsHeader(output, model, samples.size(), validationLoss)) {
+        std::cerr << "Cannot write " << output << std::endl;
+        return 84;
+    }
+    std::printf("wrote %s (rebuild with make)\n", output.c_str());
+    return 0;
+}